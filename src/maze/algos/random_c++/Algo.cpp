@@ -2,6 +2,8 @@
 
 #include <string>
 
+namespace random_cpp {
+
 void Algo::generate(Interface* interface) {
     std::string directions = "nesw";
     for (int x = 0; x < interface->getWidth(); x += 1) {
@@ -13,3 +15,5 @@ void Algo::generate(Interface* interface) {
         }
     }
 }
+
+} // namespace random_cpp
@@ -2,9 +2,13 @@
 
 #include "Interface.h"
 
+namespace random_cpp {
+
 class Algo {
 
 public:
     void generate(Interface* interface);
 
 };
+
+} // namespace random_cpp
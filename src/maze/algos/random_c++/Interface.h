@@ -1,14 +1,21 @@
 #pragma once
 
 #include <map>
+#include <random>
 #include <vector>
 
+namespace random_cpp {
+
 class Interface {
 
 public:
+    // If no random number generator is given, rand() is used instead, which
+    // is shared by the whole process; a generator makes the algorithm safe to
+    // run on several threads at once
     Interface(
         std::vector<std::vector<std::map<char, bool> > >* maze,
-        bool* success);
+        bool* success,
+        std::mt19937* generator = nullptr);
 
     int getWidth();
     int getHeight();
@@ -18,5 +25,8 @@ public:
 private:
     std::vector<std::vector<std::map<char, bool> > >* m_maze;
     bool* m_success;
+    std::mt19937* m_generator;
 
 };
+
+} // namespace random_cpp
@@ -55,8 +55,8 @@ int main(int argc, char* argv[]) {
 
     bool success = true;
 
-    Interface interface(&maze, &success);
-    Algo().generate(&interface);
+    random_cpp::Interface interface(&maze, &success);
+    random_cpp::Algo().generate(&interface);
 
     if (!success) {
         return 1;
@@ -5,6 +5,8 @@
 #include <queue>
 #include <iostream>
 
+namespace tomasz {
+
 void Algo::generate(Interface* interface) {
     m_mazeInterface = interface;
     generateMaze(interface->getWidth(), interface->getHeight());
@@ -582,3 +584,5 @@ Algo::TomMazeGenTile* Algo::getTile(int x, int y, Direction direction){
     
     return &m_maze.at(x).at(y);
 }
+
+} // namespace tomasz
@@ -6,6 +6,8 @@
 
 #include "Interface.h"
 
+namespace tomasz {
+
 enum Direction { NORTH, EAST, SOUTH, WEST, UNDEFINED };
 
 class Algo {
@@ -133,3 +135,5 @@ private:
     Interface* m_mazeInterface;
 
 };
+
+} // namespace tomasz
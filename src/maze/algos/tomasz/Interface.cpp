@@ -3,11 +3,15 @@
 #include <cstdlib>
 #include <iostream>
 
+namespace tomasz {
+
 Interface::Interface(
     std::vector<std::vector<std::map<char, bool> > >* maze,
-    bool* success) :
+    bool* success,
+    std::mt19937* generator) :
     m_maze(maze),
-    m_success(success) {
+    m_success(success),
+    m_generator(generator) {
 }
 
 int Interface::getWidth() {
@@ -19,6 +23,10 @@ int Interface::getHeight() {
 }
 
 double Interface::getRandomFloat() {
+    if (m_generator != nullptr) {
+        return static_cast<double>((*m_generator)()) /
+               static_cast<double>(std::mt19937::max());
+    }
     return static_cast<double>(rand()) / static_cast<double>(RAND_MAX);
 }
 
@@ -75,3 +83,5 @@ void Interface::setWall(int x, int y, char direction, bool wallExists) {
         }
     }
 }
+
+} // namespace tomasz
@@ -55,8 +55,8 @@ int main(int argc, char* argv[]) {
 
     bool success = true;
 
-    Interface interface(&maze, &success);
-    Algo().generate(&interface);
+    tomasz::Interface interface(&maze, &success);
+    tomasz::Algo().generate(&interface);
 
     if (!success) {
         return 1;
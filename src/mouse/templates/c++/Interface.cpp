@@ -156,33 +156,43 @@ void Interface::acknowledgeInputButtonPressed(int inputButton) {
     READ();
 }
 
-double Interface::getWheelMaxSpeed(const std::string& name) {
-    PRINT("getWheelMaxSpeed", name);
+int Interface::getWheelHandle(const std::string& name) {
+    PRINT("getWheelHandle", name);
+    READ_AND_RETURN_INT();
+}
+
+int Interface::getSensorHandle(const std::string& name) {
+    PRINT("getSensorHandle", name);
+    READ_AND_RETURN_INT();
+}
+
+double Interface::getWheelMaxSpeed(int wheel) {
+    PRINT("getWheelMaxSpeed", wheel);
     READ_AND_RETURN_DOUBLE();
 }
 
-void Interface::setWheelSpeed(const std::string& name, double rpm) {
-    PRINT("setWheelSpeed", name, rpm);
+void Interface::setWheelSpeed(int wheel, double rpm) {
+    PRINT("setWheelSpeed", wheel, rpm);
     READ();
 }
 
-double Interface::getWheelEncoderTicksPerRevolution(const std::string& name) {
-    PRINT("getWheelEncoderTicksPerRevolution", name);
+double Interface::getWheelEncoderTicksPerRevolution(int wheel) {
+    PRINT("getWheelEncoderTicksPerRevolution", wheel);
     READ_AND_RETURN_DOUBLE();
 }
 
-int Interface::readWheelEncoder(const std::string& name) {
-    PRINT("readWheelEncoder", name);
+int Interface::readWheelEncoder(int wheel) {
+    PRINT("readWheelEncoder", wheel);
     READ_AND_RETURN_INT();
 }
 
-void Interface::resetWheelEncoder(const std::string& name) {
-    PRINT("resetWheelEncoder", name);
+void Interface::resetWheelEncoder(int wheel) {
+    PRINT("resetWheelEncoder", wheel);
     READ();
 }
 
-double Interface::readSensor(const std::string& name) {
-    PRINT("readSensor", name);
+double Interface::readSensor(int sensor) {
+    PRINT("readSensor", sensor);
     READ_AND_RETURN_DOUBLE();
 }
 
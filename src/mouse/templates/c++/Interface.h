@@ -68,23 +68,28 @@ public:
 
     // ----- Continuous interface methods ----- //
 
+    // Look up the handle of a wheel or sensor by name, once, and then use
+    // the handle to refer to it; returns -1 if there's no such wheel or sensor
+    int getWheelHandle(const std::string& name);
+    int getSensorHandle(const std::string& name);
+
     // Get the magnitude of the max speed of any one wheel in rpm
-    double getWheelMaxSpeed(const std::string& name);
+    double getWheelMaxSpeed(int wheel);
 
     // Set the speed of any one wheel
-    void setWheelSpeed(const std::string& name, double rpm);
+    void setWheelSpeed(int wheel, double rpm);
 
     // Get the number of encoder ticks per revolution for a wheel
-    double getWheelEncoderTicksPerRevolution(const std::string& name);
+    double getWheelEncoderTicksPerRevolution(int wheel);
 
     // Read the encoder for a particular wheel
-    int readWheelEncoder(const std::string& name);
+    int readWheelEncoder(int wheel);
 
     // Reset the encoder for a particular wheel to zero, but only if the encoder type is relative
-    void resetWheelEncoder(const std::string& name);
+    void resetWheelEncoder(int wheel);
 
     // Returns a value in [0.0, 1.0]
-    double readSensor(const std::string& name);
+    double readSensor(int sensor);
 
     // Returns deg/s of rotation
     double readGyro();
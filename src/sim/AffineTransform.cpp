@@ -0,0 +1,101 @@
+#include "AffineTransform.h"
+
+#include "units/Distance.h"
+
+namespace mms {
+
+AffineTransform::AffineTransform() : AffineTransform(1.0, 0.0, 0.0, 1.0, 0.0, 0.0) {
+}
+
+AffineTransform AffineTransform::Translation(const Coordinate& translation) {
+    return AffineTransform(
+        1.0, 0.0,
+        0.0, 1.0,
+        translation.getX().getMeters(),
+        translation.getY().getMeters());
+}
+
+AffineTransform AffineTransform::Rotation(const Angle& angle, const Coordinate& point) {
+    // Move the point to the origin, rotate, then move the point back
+    double cos = angle.getCos();
+    double sin = angle.getSin();
+    double px = point.getX().getMeters();
+    double py = point.getY().getMeters();
+    return AffineTransform(
+        cos, -sin,
+        sin, cos,
+        px - cos * px + sin * py,
+        py - sin * px - cos * py);
+}
+
+AffineTransform AffineTransform::then(const AffineTransform& other) const {
+    // The product (other * this) of the two 3x3 matrices
+    return AffineTransform(
+        other.m_a * m_a + other.m_b * m_c,
+        other.m_a * m_b + other.m_b * m_d,
+        other.m_c * m_a + other.m_d * m_c,
+        other.m_c * m_b + other.m_d * m_d,
+        other.m_a * m_tx + other.m_b * m_ty + other.m_tx,
+        other.m_c * m_tx + other.m_d * m_ty + other.m_ty);
+}
+
+Coordinate AffineTransform::map(const Coordinate& point) const {
+    double x = point.getX().getMeters();
+    double y = point.getY().getMeters();
+    return Coordinate::Cartesian(
+        Distance::Meters(mapX(x, y)),
+        Distance::Meters(mapY(x, y)));
+}
+
+double AffineTransform::mapX(double x, double y) const {
+    return m_a * x + m_b * y + m_tx;
+}
+
+double AffineTransform::mapY(double x, double y) const {
+    return m_c * x + m_d * y + m_ty;
+}
+
+double AffineTransform::getA() const {
+    return m_a;
+}
+
+double AffineTransform::getB() const {
+    return m_b;
+}
+
+double AffineTransform::getC() const {
+    return m_c;
+}
+
+double AffineTransform::getD() const {
+    return m_d;
+}
+
+double AffineTransform::getTx() const {
+    return m_tx;
+}
+
+double AffineTransform::getTy() const {
+    return m_ty;
+}
+
+double AffineTransform::getDeterminant() const {
+    return m_a * m_d - m_b * m_c;
+}
+
+AffineTransform::AffineTransform(
+        double a,
+        double b,
+        double c,
+        double d,
+        double tx,
+        double ty) :
+    m_a(a),
+    m_b(b),
+    m_c(c),
+    m_d(d),
+    m_tx(tx),
+    m_ty(ty) {
+}
+
+} // namespace mms
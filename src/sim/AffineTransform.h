@@ -0,0 +1,56 @@
+#pragma once
+
+#include "units/Angle.h"
+#include "units/Coordinate.h"
+
+namespace mms {
+
+// A 2D affine transformation, stored as the top two rows of a 3x3 matrix:
+//
+//   | a  b  tx |
+//   | c  d  ty |
+//
+// Transformations are values; composing them is a matrix multiply, and
+// applying one to a point costs four multiplications and no trig.
+class AffineTransform {
+
+public:
+
+    // The identity transformation
+    AffineTransform();
+
+    static AffineTransform Translation(const Coordinate& translation);
+    static AffineTransform Rotation(const Angle& angle, const Coordinate& point);
+
+    // The transformation equivalent to applying this one, then the other one
+    AffineTransform then(const AffineTransform& other) const;
+
+    // Applies the transformation to a point
+    Coordinate map(const Coordinate& point) const;
+    double mapX(double x, double y) const;
+    double mapY(double x, double y) const;
+
+    // The linear part of the transformation; the determinant is negative if
+    // the transformation mirrors
+    double getA() const;
+    double getB() const;
+    double getC() const;
+    double getD() const;
+    double getTx() const;
+    double getTy() const;
+    double getDeterminant() const;
+
+private:
+
+    double m_a;
+    double m_b;
+    double m_c;
+    double m_d;
+    double m_tx;
+    double m_ty;
+
+    AffineTransform(double a, double b, double c, double d, double tx, double ty);
+
+};
+
+} // namespace mms
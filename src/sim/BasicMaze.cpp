@@ -0,0 +1,187 @@
+#include "BasicMaze.h"
+
+#include "Assert.h"
+
+namespace mms {
+
+BasicMaze::BasicMaze() : BasicMaze(0, 0) {
+}
+
+BasicMaze::BasicMaze(int width, int height) :
+        m_width(width),
+        m_height(height),
+        m_sourceWidth(width),
+        m_sourceHeight(height),
+        m_horizontalWalls(width * (height + 1)),
+        m_verticalWalls((width + 1) * height),
+        m_hasInconsistentWalls(false) {
+    ASSERT_LE(0, width);
+    ASSERT_LE(0, height);
+}
+
+BasicMaze BasicMaze::fromTileWalls(
+        int width,
+        int height,
+        const QVector<unsigned char>& tileWalls) {
+    ASSERT_EQ(tileWalls.size(), width * height);
+    BasicMaze maze(width, height);
+    for (int y = 0; y < height; y += 1) {
+        for (int x = 0; x < width; x += 1) {
+            unsigned char walls = tileWalls.at(maze.getTileIndex(x, y));
+            for (int i = 0; i < DIRECTIONS().size(); i += 1) {
+                Direction direction = DIRECTIONS().at(i);
+                bool isWall = (walls & (1 << i)) != 0;
+                int neighbor = maze.getNeighborIndex(maze.getTileIndex(x, y), direction);
+                if (neighbor != -1) {
+                    int opposite = DIRECTIONS().indexOf(DIRECTION_OPPOSITE().value(direction));
+                    bool isNeighborWall = (tileWalls.at(neighbor) & (1 << opposite)) != 0;
+                    if (isWall != isNeighborWall) {
+                        maze.m_hasInconsistentWalls = true;
+                    }
+                    isWall = isWall || isNeighborWall;
+                }
+                maze.setWall(x, y, direction, isWall);
+            }
+        }
+    }
+    return maze;
+}
+
+BasicMaze BasicMaze::fromPackedWalls(
+        int width,
+        int height,
+        const char* horizontalWalls,
+        const char* verticalWalls,
+        bool hasInconsistentWalls) {
+    BasicMaze maze(width, height);
+    maze.m_horizontalWalls = QBitArray::fromBits(horizontalWalls, width * (height + 1));
+    maze.m_verticalWalls = QBitArray::fromBits(verticalWalls, (width + 1) * height);
+    maze.m_hasInconsistentWalls = hasInconsistentWalls;
+    return maze;
+}
+
+BasicMaze BasicMaze::transformed(const MazeSymmetry& symmetry) const {
+    BasicMaze maze(*this);
+    maze.m_symmetry = m_symmetry.then(symmetry);
+    maze.m_width = maze.m_symmetry.getWidth(m_sourceWidth, m_sourceHeight);
+    maze.m_height = maze.m_symmetry.getHeight(m_sourceWidth, m_sourceHeight);
+    return maze;
+}
+
+const MazeSymmetry& BasicMaze::getSymmetry() const {
+    return m_symmetry;
+}
+
+BasicMaze BasicMaze::normalized() const {
+    if (m_symmetry.isIdentity()) {
+        return *this;
+    }
+    BasicMaze maze(m_width, m_height);
+    for (int x = 0; x < m_width; x += 1) {
+        for (int y = 0; y < m_height; y += 1) {
+            for (Direction direction : DIRECTIONS()) {
+                maze.setWall(x, y, direction, isWall(x, y, direction));
+            }
+        }
+    }
+    maze.m_hasInconsistentWalls = m_hasInconsistentWalls;
+    return maze;
+}
+
+int BasicMaze::getWidth() const {
+    return m_width;
+}
+
+int BasicMaze::getHeight() const {
+    return m_height;
+}
+
+bool BasicMaze::isEmpty() const {
+    return m_width == 0 || m_height == 0;
+}
+
+bool BasicMaze::withinMaze(int x, int y) const {
+    return 0 <= x && x < m_width && 0 <= y && y < m_height;
+}
+
+bool BasicMaze::isWall(int x, int y, Direction direction) const {
+    bool horizontal = false;
+    int bit = getWallBit(x, y, direction, &horizontal);
+    return horizontal ? m_horizontalWalls.testBit(bit) : m_verticalWalls.testBit(bit);
+}
+
+void BasicMaze::setWall(int x, int y, Direction direction, bool isWall) {
+    bool horizontal = false;
+    int bit = getWallBit(x, y, direction, &horizontal);
+    if (horizontal) {
+        m_horizontalWalls.setBit(bit, isWall);
+    }
+    else {
+        m_verticalWalls.setBit(bit, isWall);
+    }
+}
+
+bool BasicMaze::hasInconsistentWalls() const {
+    return m_hasInconsistentWalls;
+}
+
+int BasicMaze::getTileIndex(int x, int y) const {
+    ASSERT_TR(withinMaze(x, y));
+    return y * m_width + x;
+}
+
+int BasicMaze::getNeighborIndex(int index, Direction direction) const {
+    int x = index % m_width;
+    int y = index / m_width;
+    switch (direction) {
+        case Direction::NORTH:
+            return y < m_height - 1 ? index + m_width : -1;
+        case Direction::EAST:
+            return x < m_width - 1 ? index + 1 : -1;
+        case Direction::SOUTH:
+            return 0 < y ? index - m_width : -1;
+        case Direction::WEST:
+            return 0 < x ? index - 1 : -1;
+    }
+    return -1;
+}
+
+bool BasicMaze::isWall(int index, Direction direction) const {
+    return isWall(index % m_width, index / m_width, direction);
+}
+
+const QBitArray& BasicMaze::getHorizontalWalls() const {
+    return m_horizontalWalls;
+}
+
+const QBitArray& BasicMaze::getVerticalWalls() const {
+    return m_verticalWalls;
+}
+
+int BasicMaze::getWallBit(int x, int y, Direction direction, bool* horizontal) const {
+    ASSERT_TR(withinMaze(x, y));
+    if (!m_symmetry.isIdentity()) {
+        QPair<int, int> source = m_symmetry.toSource(x, y, m_sourceWidth, m_sourceHeight);
+        x = source.first;
+        y = source.second;
+        direction = m_symmetry.toSource(direction);
+    }
+    switch (direction) {
+        case Direction::NORTH:
+            *horizontal = true;
+            return (y + 1) * m_sourceWidth + x;
+        case Direction::EAST:
+            *horizontal = false;
+            return y * (m_sourceWidth + 1) + x + 1;
+        case Direction::SOUTH:
+            *horizontal = true;
+            return y * m_sourceWidth + x;
+        case Direction::WEST:
+            *horizontal = false;
+            return y * (m_sourceWidth + 1) + x;
+    }
+    ASSERT_NEVER_RUNS();
+    return 0;
+}
+
+} // namespace mms
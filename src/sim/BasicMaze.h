@@ -1,13 +1,99 @@
 #pragma once
 
-#include <QMap>
+#include <QBitArray>
 #include <QVector>
 
 #include "Direction.h"
+#include "MazeSymmetry.h"
 
 namespace mms {
 
-typedef QMap<Direction, bool> BasicTile;
-typedef QVector<QVector<BasicTile>> BasicMaze;
+// A flat store of the walls of a maze. Each wall is a single bit that is
+// shared by the two tiles on either side of it, so a tile's walls can never
+// disagree with its neighbors' walls. Horizontal walls (south and north) are
+// stored row by row, with height + 1 rows of width walls, and vertical walls
+// (west and east) are stored row by row, with height rows of width + 1 walls.
+//
+// A maze may also be a transformed view of another maze, in which case it
+// shares the other maze's wall bits (QBitArray is implicitly shared) and maps
+// coordinates and directions back to them on access.
+class BasicMaze {
+
+public:
+
+    // An empty maze, with no tiles
+    BasicMaze();
+
+    // A width x height maze with no walls at all
+    BasicMaze(int width, int height);
+
+    // Builds a maze from per-tile wall specifications, as used by file formats
+    // that list the walls of each tile separately. The tile walls are given
+    // in row-major order, with bit i set if DIRECTIONS().at(i) is a wall. If
+    // two neighbors disagree about the wall between them, the wall is present
+    // and the maze is flagged as having inconsistent walls.
+    static BasicMaze fromTileWalls(
+        int width,
+        int height,
+        const QVector<unsigned char>& tileWalls);
+
+    // Builds a maze from packed wall bits, in the same layout (and bit order)
+    // as QBitArray::bits() of the horizontal and vertical walls
+    static BasicMaze fromPackedWalls(
+        int width,
+        int height,
+        const char* horizontalWalls,
+        const char* verticalWalls,
+        bool hasInconsistentWalls);
+
+    // A view of this maze with the given symmetry applied; no walls are copied
+    BasicMaze transformed(const MazeSymmetry& symmetry) const;
+    const MazeSymmetry& getSymmetry() const;
+
+    // An equivalent maze whose wall bits are laid out in its own coordinates,
+    // i.e., with the identity symmetry; only copies the walls if necessary
+    BasicMaze normalized() const;
+
+    int getWidth() const;
+    int getHeight() const;
+    bool isEmpty() const;
+    bool withinMaze(int x, int y) const;
+
+    bool isWall(int x, int y, Direction direction) const;
+    void setWall(int x, int y, Direction direction, bool isWall);
+
+    // Whether the maze was built from tile walls that disagree with each other
+    bool hasInconsistentWalls() const;
+
+    // Row-major tile indices, and O(1) access to neighbors by index. The
+    // neighbor index is -1 if there's no tile in the given direction.
+    int getTileIndex(int x, int y) const;
+    int getNeighborIndex(int index, Direction direction) const;
+    bool isWall(int index, Direction direction) const;
+
+    // The raw wall bits, e.g., for writing them out in packed form. These are
+    // in the coordinates of the source maze, so callers should normalize
+    // transformed mazes first.
+    const QBitArray& getHorizontalWalls() const;
+    const QBitArray& getVerticalWalls() const;
+
+private:
+
+    // The dimensions of the maze, and of the maze whose walls we store
+    int m_width;
+    int m_height;
+    int m_sourceWidth;
+    int m_sourceHeight;
+    MazeSymmetry m_symmetry;
+
+    QBitArray m_horizontalWalls;
+    QBitArray m_verticalWalls;
+    bool m_hasInconsistentWalls;
+
+    // Returns the bit for the wall on the given side of the tile, and
+    // whether that bit is in the horizontal or vertical walls
+    int getWallBit(int x, int y, Direction direction, bool* horizontal) const;
+
+};
 
 } // namespace mms
@@ -0,0 +1,27 @@
+#pragma once
+
+namespace mms {
+
+// A square block of tiles whose triangles are contiguous in the CPU buffers,
+// so that it can be culled, or drawn with a single call, as a unit
+struct BufferChunk {
+
+    // The physical bounds of the chunk, in meters
+    double minX;
+    double minY;
+    double maxX;
+    double maxY;
+
+    // The triangles of the chunk within the graphic cpu buffer; the corner
+    // triangles are a contiguous subrange, so they can be skipped
+    int graphicStart;
+    int graphicCount;
+    int cornerStart;
+    int cornerCount;
+
+    // The triangles of the chunk within the texture cpu buffer
+    int textureStart;
+    int textureCount;
+};
+
+} // namespace mms
@@ -1,17 +1,18 @@
 #include "BufferInterface.h"
 
+#include "Assert.h"
 #include "RGB.h"
-#include "SimUtilities.h"
 
 namespace mms {
 
 BufferInterface::BufferInterface(
-        QPair<int, int> mazeSize,
-        QVector<TriangleGraphic>* graphicCpuBuffer,
+        const MazeGeometry* mazeGeometry,
+        QVector<TriangleColor>* graphicCpuBuffer,
         QVector<TriangleTexture>* textureCpuBuffer) :
-        m_mazeSize(mazeSize),
+        m_mazeGeometry(mazeGeometry),
         m_graphicCpuBuffer(graphicCpuBuffer),
         m_textureCpuBuffer(textureCpuBuffer) {
+    initChunks();
 }
 
 void BufferInterface::initTileGraphicText(
@@ -28,20 +29,25 @@ void BufferInterface::initTileGraphicText(
         borderFraction,
         tileTextAlignment
     );
+
+    // The texture ranges of the chunks depend on the text size
+    initChunks();
 }
 
 QPair<int, int> BufferInterface::getTileGraphicTextMaxSize() {
     return m_tileGraphicTextCache.getTileGraphicTextMaxSize();
 }
 
-void BufferInterface::insertIntoGraphicCpuBuffer(const Polygon& polygon, Color color, double alpha) {
-    QVector<TriangleGraphic> tgs = SimUtilities::polygonToTriangleGraphics(polygon, color, alpha);
-    for (int i = 0; i < tgs.size(); i += 1) {
-        m_graphicCpuBuffer->push_back(tgs.at(i));
-    }
+const QVector<BufferChunk>& BufferInterface::getChunks() const {
+    return m_chunks;
+}
+
+void BufferInterface::allocateGraphicCpuBuffer() {
+    m_graphicCpuBuffer->resize(m_mazeGeometry->size());
+    m_dirtyGraphicTriangles.fill(true, m_mazeGeometry->size());
 }
 
-void BufferInterface::insertIntoTextureCpuBuffer() {
+void BufferInterface::allocateTextureCpuBuffer() {
     // Here we just insert dummy TriangleTexture objects. All of the actual
     // values of the objects will be set on calls to the update method.
     // However, we do intentionally insert the appropriate 'v' values, since
@@ -57,43 +63,33 @@ void BufferInterface::insertIntoTextureCpuBuffer() {
         {0.0, 0.0, 0.0, 1.0},
         {0.0, 0.0, 0.0, 0.0},
     };
-    m_textureCpuBuffer->push_back(t1);
-    m_textureCpuBuffer->push_back(t2);
+    QPair<int, int> maxRowsAndCols = getTileGraphicTextMaxSize();
+    int characters =
+        maxRowsAndCols.first * maxRowsAndCols.second *
+        m_mazeGeometry->size() / MazeGeometry::trianglesPerTile();
+    m_textureCpuBuffer->resize(2 * characters);
+    for (int i = 0; i < characters; i += 1) {
+        (*m_textureCpuBuffer)[2 * i] = t1;
+        (*m_textureCpuBuffer)[2 * i + 1] = t2;
+    }
+    m_dirtyTextureTiles.fill(true, m_mazeGeometry->size() / MazeGeometry::trianglesPerTile());
 }
 
 void BufferInterface::updateTileGraphicBaseColor(int x, int y, Color color) {
-    int index = getTileGraphicBaseStartingIndex(x, y);
-    RGB rgb = COLOR_TO_RGB().value(color);
-    for (int i = 0; i < 2; i += 1) {
-        TriangleGraphic* triangleGraphic = &(*m_graphicCpuBuffer)[index + i];
-        triangleGraphic->p1.rgb = rgb;
-        triangleGraphic->p2.rgb = rgb;
-        triangleGraphic->p3.rgb = rgb;
-    }
+    updateColor(m_mazeGeometry->getTileGraphicBaseStartingIndex(x, y), 2, color, 1.0);
 }
 
 void BufferInterface::updateTileGraphicWallColor(int x, int y, Direction direction, Color color, double alpha) {
-    int index = getTileGraphicWallStartingIndex(x, y, direction);
-    RGB rgb = COLOR_TO_RGB().value(color);
-    for (int i = 0; i < 2; i += 1) {
-        TriangleGraphic* triangleGraphic = &(*m_graphicCpuBuffer)[index + i];
-        triangleGraphic->p1.rgb = rgb;
-        triangleGraphic->p2.rgb = rgb;
-        triangleGraphic->p3.rgb = rgb;
-        triangleGraphic->p1.a = alpha;
-        triangleGraphic->p2.a = alpha;
-        triangleGraphic->p3.a = alpha;
-    }
+    updateColor(m_mazeGeometry->getTileGraphicWallStartingIndex(x, y, direction), 2, color, alpha);
 }
 
-void BufferInterface::updateTileGraphicFog(int x, int y, double alpha) {
-    int index = getTileGraphicFogStartingIndex(x, y);
-    for (int i = 0; i < 2; i += 1) {
-        TriangleGraphic* triangleGraphic = &(*m_graphicCpuBuffer)[index + i];
-        triangleGraphic->p1.a = alpha;
-        triangleGraphic->p2.a = alpha;
-        triangleGraphic->p3.a = alpha;
-    }
+void BufferInterface::updateTileGraphicCornerColor(int x, int y, Color color) {
+    // The corners of a tile are contiguous
+    updateColor(m_mazeGeometry->getTileGraphicCornerStartingIndex(x, y, 0), 8, color, 1.0);
+}
+
+void BufferInterface::updateTileGraphicFog(int x, int y, Color color, double alpha) {
+    updateColor(m_mazeGeometry->getTileGraphicFogStartingIndex(x, y), 2, color, alpha);
 }
 
 void BufferInterface::updateTileGraphicText(int x, int y, int numRows, int numCols, int row, int col, QChar c) {
@@ -112,6 +108,7 @@ void BufferInterface::updateTileGraphicText(int x, int y, int numRows, int numCo
     QPair<Coordinate, Coordinate> LL_UR =
         m_tileGraphicTextCache.getTileGraphicTextPosition(x, y, numRows, numCols, row, col);
 
+    markTileDirty(&m_dirtyTextureTiles, x, y);
     int triangleTextureIndex = getTileGraphicTextStartingIndex(x, y, row, col);
     TriangleTexture* t1 = &(*m_textureCpuBuffer)[triangleTextureIndex];
     TriangleTexture* t2 = &(*m_textureCpuBuffer)[triangleTextureIndex + 1];
@@ -137,37 +134,80 @@ void BufferInterface::updateTileGraphicText(int x, int y, int numRows, int numCo
     t2->p3.u = fontImageCharacterPosition.second;
 }
 
-int BufferInterface::trianglesPerTile() {
-    // This value must be predetermined, and was done so as follows:
-    // Base polygon:      2 (2 triangles x 1 polygon  per tile)
-    // Wall polygon:      8 (2 triangles x 4 polygons per tile)
-    // Corner polygon:    8 (2 triangles x 4 polygons per tile)
-    // Fog polygon:       2 (2 triangles x 1 polygon  per tile)
-    // --------------------
-    // Total             20
-    return 20;
+QVector<QPair<int, int>> BufferInterface::takeDirtyGraphicRanges() {
+    return takeDirtyRanges(&m_dirtyGraphicTriangles, 1);
+}
+
+QVector<QPair<int, int>> BufferInterface::takeDirtyTextureRanges() {
+    QPair<int, int> maxRowsAndCols = getTileGraphicTextMaxSize();
+    return takeDirtyRanges(&m_dirtyTextureTiles, 2 * maxRowsAndCols.first * maxRowsAndCols.second);
 }
 
-int BufferInterface::getTileGraphicBaseStartingIndex(int x, int y) {
-    return  0 + trianglesPerTile() * (m_mazeSize.second * x + y);
+void BufferInterface::markTileDirty(QBitArray* dirtyTiles, int x, int y) {
+    int before, count, index;
+    m_mazeGeometry->getChunkLayout(x, y, &before, &count, &index);
+    if (before + index < dirtyTiles->size()) {
+        dirtyTiles->setBit(before + index);
+    }
 }
 
-int BufferInterface::getTileGraphicWallStartingIndex(int x, int y, Direction direction) {
-    return  2 + trianglesPerTile() * (m_mazeSize.second * x + y) + (2 * DIRECTIONS().indexOf(direction));
+QVector<QPair<int, int>> BufferInterface::takeDirtyRanges(QBitArray* dirtyBits, int trianglesPerBit) {
+
+    // Coalesce runs of dirty bits, so that neighboring updates, e.g., the
+    // tiles along a path, are written with a single call
+    QVector<QPair<int, int>> ranges;
+    int runStart = -1;
+    for (int i = 0; i <= dirtyBits->size(); i += 1) {
+        bool dirty = i < dirtyBits->size() && dirtyBits->testBit(i);
+        if (dirty && runStart == -1) {
+            runStart = i;
+        }
+        else if (!dirty && runStart != -1) {
+            ranges.append({trianglesPerBit * runStart, trianglesPerBit * (i - runStart)});
+            runStart = -1;
+        }
+    }
+    dirtyBits->fill(false);
+    return ranges;
 }
 
-int BufferInterface::getTileGraphicCornerStartingIndex(int x, int y, int cornerNumber) {
-    return 10 + trianglesPerTile() * (m_mazeSize.second * x + y) + (2 * cornerNumber);
+void BufferInterface::initChunks() {
+
+    // The bounds and graphic ranges come from the geometry, but the
+    // texture ranges depend on the text size of this particular view
+    QPair<int, int> maxRowsAndCols = getTileGraphicTextMaxSize();
+    int texturesPerTile = 2 * maxRowsAndCols.first * maxRowsAndCols.second;
+    int trianglesPerTile = MazeGeometry::trianglesPerTile();
+
+    m_chunks = m_mazeGeometry->getChunks();
+    for (int i = 0; i < m_chunks.size(); i += 1) {
+        BufferChunk& chunk = m_chunks[i];
+        chunk.textureStart = texturesPerTile * (chunk.graphicStart / trianglesPerTile);
+        chunk.textureCount = texturesPerTile * (chunk.graphicCount / trianglesPerTile);
+    }
 }
 
-int BufferInterface::getTileGraphicFogStartingIndex(int x, int y) {
-    return 18 + trianglesPerTile() * (m_mazeSize.second * x + y);
+void BufferInterface::updateColor(int index, int count, Color color, double alpha) {
+    // The triangles of a tile are grouped by kind within its chunk (see
+    // MazeGeometry), so the exact triangles are marked, not the whole tile
+    if (index + count <= m_dirtyGraphicTriangles.size()) {
+        m_dirtyGraphicTriangles.fill(true, index, index + count);
+    }
+    RGB rgb = COLOR_TO_RGB().value(color);
+    for (int i = 0; i < count; i += 1) {
+        TriangleColor* triangleColor = &(*m_graphicCpuBuffer)[index + i];
+        triangleColor->p1 = {rgb, alpha};
+        triangleColor->p2 = {rgb, alpha};
+        triangleColor->p3 = {rgb, alpha};
+    }
 }
 
 int BufferInterface::getTileGraphicTextStartingIndex(int x, int y, int row, int col) {
     QPair<int, int> maxRowsAndCols = getTileGraphicTextMaxSize();
     int triangleTexturesPerTile = 2 * maxRowsAndCols.first * maxRowsAndCols.second;
-    return triangleTexturesPerTile * (m_mazeSize.second * x + y) + 2 * (row * maxRowsAndCols.second + col);
+    int before, count, index;
+    m_mazeGeometry->getChunkLayout(x, y, &before, &count, &index);
+    return triangleTexturesPerTile * (before + index) + 2 * (row * maxRowsAndCols.second + col);
 }
 
 } // namespace mms
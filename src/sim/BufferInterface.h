@@ -1,15 +1,17 @@
 #pragma once
 
+#include <QBitArray>
 #include <QChar>
 #include <QPair>
 #include <QVector>
 
+#include "BufferChunk.h"
 #include "Color.h"
 #include "Direction.h"
-#include "Polygon.h"
+#include "MazeGeometry.h"
 #include "TileGraphicTextCache.h"
 #include "TileTextAlignment.h"
-#include "TriangleGraphic.h"
+#include "TriangleColor.h"
 #include "TriangleTexture.h"
 
 namespace mms {
@@ -19,8 +21,8 @@ class BufferInterface {
 public:
 
     BufferInterface(
-        QPair<int, int> mazeSize,
-        QVector<TriangleGraphic>* graphicCpuBuffer,
+        const MazeGeometry* mazeGeometry,
+        QVector<TriangleColor>* graphicCpuBuffer,
         QVector<TriangleTexture>* textureCpuBuffer);
 
     // Initializes and caches all possible tile text positions. We need this
@@ -35,35 +37,55 @@ public:
     // Returns the maximum number of rows and columns of text in a tile graphic
     QPair<int, int> getTileGraphicTextMaxSize();
 
-    // Fills the graphic cpu buffer and texture cpu buffer
-    void insertIntoGraphicCpuBuffer(const Polygon& polygon, Color color, double alpha);
-    void insertIntoTextureCpuBuffer();
+    // Returns the chunks, in buffer order
+    const QVector<BufferChunk>& getChunks() const;
 
-    // These methods are inexpensive, and may be called many times
+    // Sizes the graphic cpu buffer and texture cpu buffer for the whole maze
+    void allocateGraphicCpuBuffer();
+    void allocateTextureCpuBuffer();
+
+    // These methods are inexpensive, and may be called many times. The
+    // positions of the triangles are owned by the MazeGeometry, so only
+    // the colors of the triangles are written to the graphic cpu buffer.
     void updateTileGraphicBaseColor(int x, int y, Color color);
     void updateTileGraphicWallColor(int x, int y, Direction direction, Color color, double alpha);
-    void updateTileGraphicFog(int x, int y, double alpha);
+    void updateTileGraphicCornerColor(int x, int y, Color color);
+    void updateTileGraphicFog(int x, int y, Color color, double alpha);
     void updateTileGraphicText(int x, int y, int numRows, int numCols, int row, int col, QChar c);
 
+    // Returns the (start, count) ranges of triangles in each of the cpu
+    // buffers that have changed since the ranges were last taken, and then
+    // forgets them
+    QVector<QPair<int, int>> takeDirtyGraphicRanges();
+    QVector<QPair<int, int>> takeDirtyTextureRanges();
+
 private:
 
-    // The width and height of the maze
-    QPair<int, int> m_mazeSize;
+    // The shared positions, which also determine the buffer layout
+    const MazeGeometry* m_mazeGeometry;
 
     // CPU-side buffers
-    QVector<TriangleGraphic>* m_graphicCpuBuffer;
+    QVector<TriangleColor>* m_graphicCpuBuffer;
     QVector<TriangleTexture>* m_textureCpuBuffer;
 
+    // What has changed in each of the cpu buffers since it was last taken:
+    // the graphic triangles themselves, since the triangles of a tile aren't
+    // contiguous, and the tiles (in buffer order) of the texture triangles,
+    // which are
+    QBitArray m_dirtyGraphicTriangles;
+    QBitArray m_dirtyTextureTiles;
+    void markTileDirty(QBitArray* dirtyTiles, int x, int y);
+    static QVector<QPair<int, int>> takeDirtyRanges(QBitArray* dirtyBits, int trianglesPerBit);
+
     // A cache for tile graphic text information
     TileGraphicTextCache m_tileGraphicTextCache;
 
-    // Retrieve the indices into the graphic cpu buffer,
-    // for each specific type of Tile triangle
-    int trianglesPerTile();
-    int getTileGraphicBaseStartingIndex(int x, int y);
-    int getTileGraphicWallStartingIndex(int x, int y, Direction direction);
-    int getTileGraphicCornerStartingIndex(int x, int y, int cornerNumber);
-    int getTileGraphicFogStartingIndex(int x, int y);
+    // The chunks, which depend on both the maze size and the text size
+    QVector<BufferChunk> m_chunks;
+    void initChunks();
+
+    // Writes a single color to a range of triangles
+    void updateColor(int index, int count, Color color, double alpha);
 
     // Retrieve the indices into the texture cpu buffer
     int getTileGraphicTextStartingIndex(int x, int y, int row, int col);
@@ -0,0 +1,276 @@
+#include "CollisionShape.h"
+
+#include <QVarLengthArray>
+#include <QtMath>
+
+#include <algorithm>
+#include <limits>
+
+#include "Assert.h"
+#include "Direction.h"
+#include "Param.h"
+#include "polypartition/polypartition.h"
+
+namespace mms {
+
+CollisionShape::CollisionShape() {
+}
+
+CollisionShape::CollisionShape(const QVector<Polygon>& polygons) {
+    for (const Polygon& polygon : polygons) {
+        for (const Polygon& convex : decompose(polygon)) {
+
+            // The bounding circle is centered on the average of the vertices,
+            // which isn't the smallest possible circle, but is close enough
+            Part part;
+            part.polygon = convex;
+            part.centerX = 0.0;
+            part.centerY = 0.0;
+            for (int i = 0; i < convex.size(); i += 1) {
+                part.centerX += convex.getX(i) / convex.size();
+                part.centerY += convex.getY(i) / convex.size();
+            }
+            part.radius = 0.0;
+            for (int i = 0; i < convex.size(); i += 1) {
+                part.radius = std::max(part.radius, std::hypot(
+                    convex.getX(i) - part.centerX,
+                    convex.getY(i) - part.centerY));
+            }
+            m_parts.append(part);
+        }
+    }
+}
+
+QVector<Polygon> CollisionShape::getParts() const {
+    QVector<Polygon> parts;
+    for (const Part& part : m_parts) {
+        parts.append(part.polygon);
+    }
+    return parts;
+}
+
+bool CollisionShape::collides(const AffineTransform& transform, const Maze& maze) const {
+
+    // NOTE: This is a performance critical function
+
+    // The walls and posts are centered on the tile boundaries, which are
+    // the lines x = i * tileLength and y = j * tileLength
+    double halfWallWidth = P()->wallWidth() / 2.0;
+    double tileLength = P()->wallLength() + P()->wallWidth();
+    int width = maze.getWidth();
+    int height = maze.getHeight();
+
+    for (const Part& part : m_parts) {
+
+        // The transformation is rigid, so the radius doesn't change
+        double centerX = transform.mapX(part.centerX, part.centerY);
+        double centerY = transform.mapY(part.centerX, part.centerY);
+        double reach = part.radius + halfWallWidth;
+
+        // The boundaries, and the tiles between them, that are close enough
+        // to the bounding circle that they could touch it
+        int minI = std::max(0, static_cast<int>(std::ceil((centerX - reach) / tileLength)));
+        int maxI = std::min(width, static_cast<int>(std::floor((centerX + reach) / tileLength)));
+        int minJ = std::max(0, static_cast<int>(std::ceil((centerY - reach) / tileLength)));
+        int maxJ = std::min(height, static_cast<int>(std::floor((centerY + reach) / tileLength)));
+        int minX = std::max(0, static_cast<int>(std::floor((centerX - reach) / tileLength)));
+        int maxX = std::min(width - 1, static_cast<int>(std::floor((centerX + reach) / tileLength)));
+        int minY = std::max(0, static_cast<int>(std::floor((centerY - reach) / tileLength)));
+        int maxY = std::min(height - 1, static_cast<int>(std::floor((centerY + reach) / tileLength)));
+
+        // Only transform the vertices of the part if some wall or post is
+        // within the bounding circle, and then only once
+        QVarLengthArray<double, 16> xs;
+        QVarLengthArray<double, 16> ys;
+        auto overlaps = [&](double left, double bottom, double right, double top) {
+            if (!intersects(centerX, centerY, part.radius, left, bottom, right, top)) {
+                return false;
+            }
+            if (xs.isEmpty()) {
+                for (int i = 0; i < part.polygon.size(); i += 1) {
+                    double x = part.polygon.getX(i);
+                    double y = part.polygon.getY(i);
+                    xs.append(transform.mapX(x, y));
+                    ys.append(transform.mapY(x, y));
+                }
+            }
+            return intersects(xs.constData(), ys.constData(), xs.size(), left, bottom, right, top);
+        };
+
+        // The posts, which are always present
+        for (int i = minI; i <= maxI; i += 1) {
+            for (int j = minJ; j <= maxJ; j += 1) {
+                if (overlaps(
+                    i * tileLength - halfWallWidth,
+                    j * tileLength - halfWallWidth,
+                    i * tileLength + halfWallWidth,
+                    j * tileLength + halfWallWidth
+                )) {
+                    return true;
+                }
+            }
+        }
+
+        // The vertical walls, between the posts
+        for (int i = minI; i <= maxI; i += 1) {
+            for (int y = minY; y <= maxY; y += 1) {
+                bool isWall = i < width
+                    ? maze.isWall(i, y, Direction::WEST)
+                    : maze.isWall(width - 1, y, Direction::EAST);
+                if (isWall && overlaps(
+                    i * tileLength - halfWallWidth,
+                    y * tileLength + halfWallWidth,
+                    i * tileLength + halfWallWidth,
+                    (y + 1) * tileLength - halfWallWidth
+                )) {
+                    return true;
+                }
+            }
+        }
+
+        // The horizontal walls, between the posts
+        for (int j = minJ; j <= maxJ; j += 1) {
+            for (int x = minX; x <= maxX; x += 1) {
+                bool isWall = j < height
+                    ? maze.isWall(x, j, Direction::SOUTH)
+                    : maze.isWall(x, height - 1, Direction::NORTH);
+                if (isWall && overlaps(
+                    x * tileLength + halfWallWidth,
+                    j * tileLength - halfWallWidth,
+                    (x + 1) * tileLength - halfWallWidth,
+                    j * tileLength + halfWallWidth
+                )) {
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+QVector<Polygon> CollisionShape::decompose(const Polygon& polygon) {
+
+    if (isConvex(polygon)) {
+        return {polygon};
+    }
+
+    TPPLPoly tpplPoly;
+    tpplPoly.Init(polygon.size());
+    for (int i = 0; i < polygon.size(); i += 1) {
+        tpplPoly[i].x = polygon.getX(i);
+        tpplPoly[i].y = polygon.getY(i);
+    }
+    tpplPoly.SetOrientation(TPPL_CCW);
+
+    // Hertel-Mehlhorn gives at most four times the minimum number of parts,
+    // which is plenty good for something that's only done at load time
+    TPPLPartition partitioner;
+    std::list<TPPLPoly> result;
+    QVector<Polygon> parts;
+    if (partitioner.ConvexPartition_HM(&tpplPoly, &result)) {
+        for (auto it = result.begin(); it != result.end(); it++) {
+            QVector<Coordinate> vertices;
+            for (int i = 0; i < it->GetNumPoints(); i += 1) {
+                vertices.append(Coordinate::Cartesian(
+                    Distance::Meters((*it)[i].x),
+                    Distance::Meters((*it)[i].y)));
+            }
+            parts.append(Polygon(vertices));
+        }
+    }
+
+    // If the partition fails, fall back to the triangulation, which is
+    // still convex, just not as coarse
+    else {
+        for (const Triangle& triangle : polygon.getTriangles()) {
+            parts.append(Polygon({triangle.p1, triangle.p2, triangle.p3}));
+        }
+    }
+
+    return parts;
+}
+
+bool CollisionShape::isConvex(const Polygon& polygon) {
+    // The polygon is convex if all of the turns are in the same direction
+    bool left = false;
+    bool right = false;
+    for (int i = 0; i < polygon.size(); i += 1) {
+        int j = (i + 1) % polygon.size();
+        int k = (i + 2) % polygon.size();
+        double cross =
+            (polygon.getX(j) - polygon.getX(i)) * (polygon.getY(k) - polygon.getY(j)) -
+            (polygon.getY(j) - polygon.getY(i)) * (polygon.getX(k) - polygon.getX(j));
+        left = left || 0 < cross;
+        right = right || cross < 0;
+    }
+    return !(left && right);
+}
+
+bool CollisionShape::intersects(
+        double centerX,
+        double centerY,
+        double radius,
+        double left,
+        double bottom,
+        double right,
+        double top) {
+    double dx = std::max(0.0, std::max(left - centerX, centerX - right));
+    double dy = std::max(0.0, std::max(bottom - centerY, centerY - top));
+    return dx * dx + dy * dy < radius * radius;
+}
+
+bool CollisionShape::intersects(
+        const double* xs,
+        const double* ys,
+        int size,
+        double left,
+        double bottom,
+        double right,
+        double top) {
+
+    // The axes of the rectangle
+    double minX = std::numeric_limits<double>::max();
+    double maxX = std::numeric_limits<double>::lowest();
+    double minY = std::numeric_limits<double>::max();
+    double maxY = std::numeric_limits<double>::lowest();
+    for (int i = 0; i < size; i += 1) {
+        minX = std::min(minX, xs[i]);
+        maxX = std::max(maxX, xs[i]);
+        minY = std::min(minY, ys[i]);
+        maxY = std::max(maxY, ys[i]);
+    }
+    if (maxX <= left || right <= minX || maxY <= bottom || top <= minY) {
+        return false;
+    }
+
+    // The normals of the edges of the polygon
+    double cornerXs[4] = {left, left, right, right};
+    double cornerYs[4] = {bottom, top, top, bottom};
+    for (int i = 0; i < size; i += 1) {
+        int j = (i + 1) % size;
+        double normalX = ys[j] - ys[i];
+        double normalY = xs[i] - xs[j];
+        double minPolygon = std::numeric_limits<double>::max();
+        double maxPolygon = std::numeric_limits<double>::lowest();
+        for (int k = 0; k < size; k += 1) {
+            double projection = normalX * xs[k] + normalY * ys[k];
+            minPolygon = std::min(minPolygon, projection);
+            maxPolygon = std::max(maxPolygon, projection);
+        }
+        double minRectangle = std::numeric_limits<double>::max();
+        double maxRectangle = std::numeric_limits<double>::lowest();
+        for (int k = 0; k < 4; k += 1) {
+            double projection = normalX * cornerXs[k] + normalY * cornerYs[k];
+            minRectangle = std::min(minRectangle, projection);
+            maxRectangle = std::max(maxRectangle, projection);
+        }
+        if (maxPolygon <= minRectangle || maxRectangle <= minPolygon) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace mms
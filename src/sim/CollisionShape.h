@@ -0,0 +1,68 @@
+#pragma once
+
+#include <QVector>
+
+#include "AffineTransform.h"
+#include "Maze.h"
+#include "Polygon.h"
+
+namespace mms {
+
+// The exact shape of everything on the mouse that can hit a wall. The shape
+// is the union of the given polygons, represented as a set of convex parts
+// (which may overlap, since a point is in the union if and only if it's in
+// some part). Each part keeps a bounding circle, so that checking for
+// collisions can dismiss most nearby walls and posts with a single distance
+// test, and only needs a separating axis test for those that are very close.
+class CollisionShape {
+
+public:
+
+    CollisionShape();
+    CollisionShape(const QVector<Polygon>& polygons);
+
+    // The convex parts of the shape
+    QVector<Polygon> getParts() const;
+
+    // Whether or not the shape, with the transformation applied to it,
+    // overlaps any of the walls or posts of the maze
+    bool collides(const AffineTransform& transform, const Maze& maze) const;
+
+private:
+
+    struct Part {
+        Polygon polygon;
+        double centerX;
+        double centerY;
+        double radius;
+    };
+    QVector<Part> m_parts;
+
+    // Splits a (possibly concave) polygon into convex polygons
+    static QVector<Polygon> decompose(const Polygon& polygon);
+    static bool isConvex(const Polygon& polygon);
+
+    // Whether or not the circle overlaps the rectangle
+    static bool intersects(
+        double centerX,
+        double centerY,
+        double radius,
+        double left,
+        double bottom,
+        double right,
+        double top);
+
+    // Whether or not the convex polygon, given by its vertices, overlaps the
+    // rectangle, as determined by the separating axis theorem
+    static bool intersects(
+        const double* xs,
+        const double* ys,
+        int size,
+        double left,
+        double bottom,
+        double right,
+        double top);
+
+};
+
+} // namespace mms
@@ -2,6 +2,9 @@
 
 #include <QPair>
 
+#include <cmath>
+
+#include "Assert.h"
 #include "WheelEffect.h"
 
 #include "units/Speed.h"
@@ -9,78 +12,85 @@
 namespace mms {
 
 CurveTurnFactorCalculator::CurveTurnFactorCalculator() :
-    m_unitForwardComponent(0.0),
-    m_unitTurnComponent(0.0) {
+    m_forwardComponentForwardRate(0.0),
+    m_forwardComponentTurnRate(0.0),
+    m_turnComponentForwardRate(0.0),
+    m_turnComponentTurnRate(0.0) {
 }
 
 CurveTurnFactorCalculator::CurveTurnFactorCalculator(
-        const QMap<QString, Wheel>& wheels,
-        const QMap<QString, QPair<double, double>>& wheelSpeedAdjustmentFactors) {
-
-    // TODO: upforgrabs
-    // Currently, this logic assumes that when the mouse has its wheel
-    // speeds set for moving forward, that it does not turn at all, and vice
-    // versa. This is not the case for mice where the wheels don't have
-    // rotational symmetry. What we really care about is that the mouse moves
-    // in the forward direction (relative to the initial direction of the
-    // mouse) as much as intended. The sideways movement (relative to to the
-    // initial direction of the mouse) can vary as needed.
-
-    // Determine the total forward and turn rate of change from all wheels
-    Speed totalForwardRateOfChange = Speed::MetersPerSecond(0);
-    AngularVelocity totalRadialRateOfChange;
-    QMap<QString, Wheel>::const_iterator it;
-    for (it = wheels.constBegin(); it != wheels.constEnd(); it += 1) {
+        const QVector<Wheel>& wheels,
+        const QVector<QPair<double, double>>& wheelSpeedAdjustmentFactors) {
+
+    // Note that the forward component doesn't necessarily cause the mouse to
+    // move only forward, nor the turn component to only turn, since the wheels
+    // of the mouse don't necessarily have rotational symmetry. So we keep
+    // track of both effects of both components, and account for them below.
+
+    // Determine the forward and turn rates of change of each component
+    Speed forwardComponentForwardRate;
+    AngularVelocity forwardComponentTurnRate;
+    Speed turnComponentForwardRate;
+    AngularVelocity turnComponentTurnRate;
+    ASSERT_EQ(wheelSpeedAdjustmentFactors.size(), wheels.size());
+    for (int i = 0; i < wheels.size(); i += 1) {
 
         // For each of the wheel speed adjustment factors, calculate the wheel's
         // contributions. Remember that each of these factors corresponds to
         // the fraction of the max wheel speed such that the mouse performs a
         // particular movement (moving forward or turning) most optimally.
-        ASSERT_TR(wheelSpeedAdjustmentFactors.contains(it.key()));
-        QPair<double, double> adjustmentFactors =
-            wheelSpeedAdjustmentFactors.value(it.key());
-
-        WheelEffect maximumEffect = it.value().getMaximumEffect();
-        for (double factor : {adjustmentFactors.first, adjustmentFactors.second}) {
-            totalForwardRateOfChange += maximumEffect.forwardEffect * factor;
-            totalRadialRateOfChange += maximumEffect.turnEffect * factor;
-        }
+        QPair<double, double> adjustmentFactors = wheelSpeedAdjustmentFactors.at(i);
+
+        WheelEffect maximumEffect = wheels.at(i).getMaximumEffect();
+        forwardComponentForwardRate += maximumEffect.forwardEffect * adjustmentFactors.first;
+        forwardComponentTurnRate += maximumEffect.turnEffect * adjustmentFactors.first;
+        turnComponentForwardRate += maximumEffect.forwardEffect * adjustmentFactors.second;
+        turnComponentTurnRate += maximumEffect.turnEffect * adjustmentFactors.second;
     }
 
-    // The main idea here is that, for a curve turn, we want the mouse to move
-    // forward a distance equal to the length of the arc we'd like it to travel.
-    // So we'd like to find a pair of factors, A and B, such that:
-    //
-    //  totalForwardRateOfChange * A   totalDistance
-    //  ---------------------------- = -------------
-    //  totalRadialRateOfChange  * B   totalRotation
-    //
-    // So we have that:
+    m_forwardComponentForwardRate = forwardComponentForwardRate.getMetersPerSecond();
+    m_forwardComponentTurnRate = forwardComponentTurnRate.getRadiansPerSecond();
+    m_turnComponentForwardRate = turnComponentForwardRate.getMetersPerSecond();
+    m_turnComponentTurnRate = turnComponentTurnRate.getRadiansPerSecond();
+}
+
+QPair<double, double> CurveTurnFactorCalculator::getCurveTurnFactors(
+        const Distance& radius,
+        bool turnLeft) const {
+
+    // For a curve turn, we want the mouse to move forward a distance equal to
+    // the length of the arc we'd like it to travel, i.e., radius per radian.
+    // Since the rate of rotation is negative when turning right, we want the
+    // ratio of the forward speed to the rate of rotation to be the radius,
+    // signed by the direction of the turn. So we'd like to find a pair of
+    // factors, A and B, such that:
     //
-    //      totalDistance   totalRadialRateOfChange
-    //  A = ------------- * ------------------------ * B
-    //      totalRotation   totalForwardRateOfChange
+    //  A * forwardComponentForwardRate + B * turnComponentForwardRate
+    //  -------------------------------------------------------------- = radius
+    //     A * forwardComponentTurnRate + B * turnComponentTurnRate
     //
-    // Now if we take the radius of the arc to be 1m, we have that:
+    // Then we can just choose B = 1.0 (or B = -1.0 to turn right, with a
+    // negative radius) and solve for A:
     //
-    //      totalRadialRateOfChange
-    //  A = ------------------------ * B
-    //      totalForwardRateOfChange
+    //          radius * turnComponentTurnRate - turnComponentForwardRate
+    //  A = B * ---------------------------------------------------------
+    //          forwardComponentForwardRate - radius * forwardComponentTurnRate
     //
-    // Then we can just choose B = 1.0 and solve for A
+    // Note that, for mice that do have rotational symmetry, the cross terms
+    // are zero, and so A is proportional to the radius. For mice that don't,
+    // A differs between left and right turns, even in place.
 
-    double B = 1.0;
-    double A = (
-        totalRadialRateOfChange.getRadiansPerSecond() /
-        totalForwardRateOfChange.getMetersPerSecond()
-    );
+    double r = radius.getMeters() * (turnLeft ? 1.0 : -1.0);
+    double B = turnLeft ? 1.0 : -1.0;
+    double numerator = r * m_turnComponentTurnRate - m_turnComponentForwardRate;
+    double denominator = m_forwardComponentForwardRate - r * m_forwardComponentTurnRate;
 
-    m_unitForwardComponent = A;
-    m_unitTurnComponent = B;
-}
-
-QPair<double, double> CurveTurnFactorCalculator::getCurveTurnFactors(const Distance& radius) {
-    return {m_unitForwardComponent * radius.getMeters(), m_unitTurnComponent};
+    // If the denominator is zero then the forward component, on its own,
+    // already moves the mouse along an arc with the given radius
+    if (std::abs(denominator) < 1e-12) {
+        return {1.0, 0.0};
+    }
+    return {B * numerator / denominator, B};
 }
 
 } // namespace mms
@@ -1,8 +1,7 @@
 #pragma once
 
-#include <QMap>
 #include <QPair>
-#include <QString>
+#include <QVector>
 
 #include "Wheel.h"
 
@@ -13,18 +12,22 @@ class CurveTurnFactorCalculator {
 public:
     CurveTurnFactorCalculator();
     CurveTurnFactorCalculator(
-        const QMap<QString, Wheel>& wheels,
-        const QMap<QString, QPair<double, double>>& wheelSpeedAdjustmentFactors);
+        const QVector<Wheel>& wheels,
+        const QVector<QPair<double, double>>& wheelSpeedAdjustmentFactors);
 
     // Returns a linear combination of forward and turn movement components
-    // such that the mouse turns along the arc with the given radius. Note that
-    // these factors are not necessarily between [-1.0, 1.0]
-    QPair<double, double> getCurveTurnFactors(const Distance& radius);
+    // such that the mouse turns, left or right, along the arc with the given
+    // radius. Note that these factors are not necessarily between [-1.0, 1.0]
+    QPair<double, double> getCurveTurnFactors(const Distance& radius, bool turnLeft) const;
 
 private:
-    // The components if the desired radius was 1m (hence "unit")
-    double m_unitForwardComponent;
-    double m_unitTurnComponent;
+    // The forward speed (m/s) and rate of rotation (rad/s) of the mouse when
+    // its wheels are set, at their max speeds, for the forward and turn
+    // movement components, respectively
+    double m_forwardComponentForwardRate;
+    double m_forwardComponentTurnRate;
+    double m_turnComponentForwardRate;
+    double m_turnComponentTurnRate;
 
 };
 
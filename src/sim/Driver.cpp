@@ -1,9 +1,17 @@
 #include "Driver.h"
 
 #include <QApplication>
+#include <QCommandLineParser>
+#include <QDebug>
+#include <QMap>
+
+#include <exception>
 
 #include "FontImage.h"
 #include "Logging.h"
+#include "MazeBatchGenerator.h"
+#include "MazeGenerator.h"
+#include "MazeValidity.h"
 #include "Screen.h"
 #include "Settings.h"
 #include "SimTime.h"
@@ -35,6 +43,12 @@ int Driver::drive(int argc, char* argv[]) {
     // Initialize the Param object
     P();
 
+    // Generate a maze corpus, without opening the window, if asked to
+    QCommandLineParser parser;
+    if (parseCorpusOptions(&parser, app.arguments())) {
+        return generateCorpus(parser);
+    }
+
     // Initialize the FontImage object
     FontImage::init(P()->tileTextFontImage());
 
@@ -46,4 +60,80 @@ int Driver::drive(int argc, char* argv[]) {
     return app.exec();
 }
 
+bool Driver::parseCorpusOptions(QCommandLineParser* parser, const QStringList& arguments) {
+    parser->setApplicationDescription("Micromouse simulator");
+    parser->addHelpOption();
+    parser->addOptions({
+        {"generate-corpus", "Generate a maze corpus into <file> and exit.", "file"},
+        {"generator", "The maze generator to use: " +
+            MazeGenerator::getNames().join(", ") + ".", "name"},
+        {"width", "The width of each maze (default 16).", "width", "16"},
+        {"height", "The height of each maze (default 16).", "height", "16"},
+        {"count", "The number of mazes to generate (default 1000).", "count", "1000"},
+        {"seed", "The batch seed (default the random-seed param).", "seed",
+            QString::number(P()->randomSeed())},
+        {"max-attempts", "The number of mazes to try (default ten times the count).",
+            "attempts"},
+        {"min-validity", "The least valid maze to keep: drawable, explorable or "
+            "official (default official).", "validity", "official"},
+        {"metadata", "Store each maze's metadata in the corpus."},
+        {"threads", "The number of threads (default one per core).", "threads", "0"},
+    });
+
+    // The window takes no options of its own, but platform and Qt arguments
+    // (e.g., -platform) reach us too, so unknown options are only an error
+    // (which process() reports before exiting) when generating a corpus
+    parser->parse(arguments);
+    if (!parser->isSet("generate-corpus") && !parser->isSet("help")) {
+        return false;
+    }
+    parser->process(arguments);
+    return true;
+}
+
+int Driver::generateCorpus(const QCommandLineParser& parser) {
+
+    QMap<QString, MazeValidity> validities {
+        {"drawable", MazeValidity::DRAWABLE},
+        {"explorable", MazeValidity::EXPLORABLE},
+        {"official", MazeValidity::OFFICIAL},
+    };
+    QString generator = parser.value("generator");
+    QString validity = parser.value("min-validity");
+    if (!validities.contains(validity)) {
+        qWarning().noquote().nospace()
+            << "Invalid minimum validity \"" << validity << "\".";
+        return 1;
+    }
+
+    int count = parser.value("count").toInt();
+    int maxAttempts = 10 * count;
+    if (parser.isSet("max-attempts")) {
+        maxAttempts = parser.value("max-attempts").toInt();
+    }
+
+    try {
+        int written = MazeBatchGenerator::generate(
+            generator,
+            parser.value("width").toInt(),
+            parser.value("height").toInt(),
+            count,
+            validities.value(validity),
+            parser.value("generate-corpus"),
+            parser.value("seed").toUInt(),
+            maxAttempts,
+            parser.isSet("metadata"),
+            parser.value("threads").toInt());
+        qInfo().noquote().nospace()
+            << "Wrote " << written << " of " << count << " mazes to \""
+            << parser.value("generate-corpus") << "\".";
+    }
+    catch (const std::exception& e) {
+        qWarning().noquote().nospace()
+            << "Unable to generate the maze corpus: " << e.what();
+        return 1;
+    }
+    return 0;
+}
+
 } // namespace mms
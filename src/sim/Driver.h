@@ -1,5 +1,8 @@
 #pragma once
 
+#include <QCommandLineParser>
+#include <QStringList>
+
 namespace mms {
 
 class Driver {
@@ -8,6 +11,14 @@ public:
     Driver() = delete;
     static int drive(int argc, char* argv[]);
 
+private:
+
+    // Returns true if the simulator was asked to generate a maze corpus
+    // (see MazeBatchGenerator) rather than to open its window; any other
+    // arguments are ignored when opening the window
+    static bool parseCorpusOptions(QCommandLineParser* parser, const QStringList& arguments);
+    static int generateCorpus(const QCommandLineParser& parser);
+
 };
 
 } // namespace mms
@@ -0,0 +1,89 @@
+#include "FrameExporter.h"
+
+#include <QElapsedTimer>
+
+#include <algorithm>
+
+#include "Logging.h"
+#include "SimTime.h"
+
+namespace mms {
+
+FrameExporter::FrameExporter(
+        const Maze* maze,
+        const QString& directory,
+        const Duration& interval,
+        const Duration& budget,
+        const QSize& size) :
+        m_offscreenMap(maze, size),
+        m_directory(directory),
+        m_interval(interval),
+        m_budget(budget),
+        m_intervalScale(1.0),
+        m_nextCaptureTime(SimTime::get()->elapsedSimTime()),
+        m_frameCount(0) {
+    if (!m_directory.exists() && !m_directory.mkpath(".")) {
+        qWarning().noquote().nospace()
+            << "Unable to create frame export directory \""
+            << m_directory.absolutePath() << "\".";
+    }
+}
+
+void FrameExporter::update(
+        const MazeView* view,
+        const MouseGraphic* mouseGraphic) {
+
+    if (m_interval.getSeconds() <= 0.0) {
+        return;
+    }
+    Duration now = SimTime::get()->elapsedSimTime();
+    if (now < m_nextCaptureTime) {
+        return;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    QImage image = m_offscreenMap.render(view, mouseGraphic);
+    save(image, QString("frame-%1.png").arg(m_frameCount, 6, 10, QChar('0')));
+    m_frameCount += 1;
+    Duration cost = Duration::Microseconds(timer.nsecsElapsed() / 1000.0);
+
+    // Skip frames rather than let exporting slow the GUI down, and go back
+    // toward the requested interval once frames fit in the budget again
+    if (m_budget < cost) {
+        m_intervalScale *= 2.0;
+        qWarning().noquote().nospace()
+            << "Frame export took " << cost.getMilliseconds()
+            << " ms, exceeding the budget of " << m_budget.getMilliseconds()
+            << " ms. Exporting every " << (m_interval * m_intervalScale).getSeconds()
+            << " sim seconds instead.";
+    }
+    else if (1.0 < m_intervalScale) {
+        m_intervalScale = std::max(1.0, m_intervalScale * 0.75);
+    }
+    m_nextCaptureTime = now + m_interval * m_intervalScale;
+}
+
+void FrameExporter::snapshot(
+        const MazeView* view,
+        const MazeView* truth,
+        const MouseGraphic* mouseGraphic) {
+    if (view != nullptr) {
+        save(m_offscreenMap.render(view, mouseGraphic), "final-view.png");
+    }
+    if (truth != nullptr) {
+        save(m_offscreenMap.render(truth, nullptr), "final-truth.png");
+    }
+}
+
+bool FrameExporter::save(const QImage& image, const QString& fileName) const {
+    QString path = m_directory.filePath(fileName);
+    bool success = image.save(path, "PNG");
+    if (!success) {
+        qWarning().noquote().nospace()
+            << "Unable to write frame \"" << path << "\".";
+    }
+    return success;
+}
+
+} // namespace mms
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <QDir>
+#include <QSize>
+#include <QString>
+
+#include "Maze.h"
+#include "MazeView.h"
+#include "MouseGraphic.h"
+#include "OffscreenMap.h"
+#include "units/Duration.h"
+
+namespace mms {
+
+// Writes PNG frames of a run, rendered by an OffscreenMap, into a directory
+class FrameExporter {
+
+public:
+
+    // An interval of zero disables periodic frames, leaving only snapshots
+    FrameExporter(
+        const Maze* maze,
+        const QString& directory,
+        const Duration& interval,
+        const Duration& budget,
+        const QSize& size);
+
+    // Captures a frame if at least one interval of sim time has elapsed since
+    // the previous frame. If capturing takes longer than the budget, the
+    // interval is doubled, and it shrinks back toward the requested interval
+    // while frames fit in the budget. The cost of a frame is everything done
+    // on the GUI thread: rendering, PNG encoding and writing the file. The
+    // encoding alone can take tens of milliseconds for large frames, so the
+    // budget may need to be raised above its default for those.
+    void update(const MazeView* view, const MouseGraphic* mouseGraphic);
+
+    // Writes the explored view and the truth, e.g., at the end of a run
+    void snapshot(
+        const MazeView* view,
+        const MazeView* truth,
+        const MouseGraphic* mouseGraphic);
+
+private:
+
+    OffscreenMap m_offscreenMap;
+    QDir m_directory;
+    Duration m_interval;
+    Duration m_budget;
+    double m_intervalScale;
+    Duration m_nextCaptureTime;
+    int m_frameCount;
+
+    bool save(const QImage& image, const QString& fileName) const;
+
+};
+
+} // namespace mms
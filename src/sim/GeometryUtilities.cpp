@@ -4,7 +4,6 @@
 #include <QtMath>
 
 #include <algorithm>
-#include <functional>
 
 #include "Assert.h"
 
@@ -130,12 +129,6 @@ Coordinate GeometryUtilities::castRay(
     Distance dx = end.getX() - start.getX();
     Distance dy = end.getY() - start.getY();
 
-    // Determine the direction of the ray
-    QPair<int, int> direction = {
-        (0 < dx.getMeters() ? 1 : -1),
-        (0 < dy.getMeters() ? 1 : -1)
-    };
-
     //  Logical Tiles
     //  =============
     //  +-----------------+-----------------+-----------------+
@@ -186,64 +179,89 @@ Coordinate GeometryUtilities::castRay(
     // boundaries to align with QRST. The same follows for south east and south
     // west rays, and IJKL and MNOP, respectively.
 
+    // The rest of the work happens on raw doubles, in a loop that's
+    // specialized on the direction of the ray (zero counts as negative)
+    double startX = start.getX().getMeters();
+    double startY = start.getY().getMeters();
+    double endX = end.getX().getMeters();
+    double endY = end.getY().getMeters();
+    double hww = halfWallWidth.getMeters();
+    double tile = tileLength.getMeters();
+    const BasicMaze& walls = maze.getWalls();
+    QPair<double, double> result;
+    if (0 < dx.getMeters()) {
+        result = 0 < dy.getMeters()
+            ? castRay<1, 1>(startX, startY, endX, endY, walls, hww, tile)
+            : castRay<1, -1>(startX, startY, endX, endY, walls, hww, tile);
+    }
+    else {
+        result = 0 < dy.getMeters()
+            ? castRay<-1, 1>(startX, startY, endX, endY, walls, hww, tile)
+            : castRay<-1, -1>(startX, startY, endX, endY, walls, hww, tile);
+    }
+    return Coordinate::Cartesian(
+        Distance::Meters(result.first),
+        Distance::Meters(result.second));
+}
+
+template<int IX, int IY>
+QPair<double, double> GeometryUtilities::castRay(
+    double startX,
+    double startY,
+    double endX,
+    double endY,
+    const BasicMaze& walls,
+    double halfWallWidth,
+    double tileLength
+) {
+    double dx = endX - startX;
+    double dy = endY - startY;
+
     // We want to shift the walls in the opposite direction of the ray
-    Coordinate logicalShift = Coordinate::Cartesian(
-        halfWallWidth * direction.first  * -1,
-        halfWallWidth * direction.second * -1
-    );
+    double shiftX = halfWallWidth * IX * -1;
+    double shiftY = halfWallWidth * IY * -1;
 
     // The current x and y positions that are tracked in the loop
-    Distance cx = start.getX();
-    Distance cy = start.getY();
+    double cx = startX;
+    double cy = startY;
 
     // Determine the logical starting tile
-    int sx = static_cast<int>(std::floor((start - logicalShift).getX() / tileLength));
-    int sy = static_cast<int>(std::floor((start - logicalShift).getY() / tileLength)); 
+    int sx = static_cast<int>(std::floor((startX - shiftX) / tileLength));
+    int sy = static_cast<int>(std::floor((startY - shiftY) / tileLength));
 
     // The initial integer tile offset from the starting tile
-    int px = (direction.first  == 1 ? 1 : 0);
-    int py = (direction.second == 1 ? 1 : 0);
+    const int px = (IX == 1 ? 1 : 0);
+    const int py = (IY == 1 ? 1 : 0);
 
     // The current integer tile offset from the starting tile
     int ox = px;
     int oy = py;
 
-    // The increment to take on the offset values
-    int ix = direction.first;
-    int iy = direction.second;
-
     // The x and y values of the next potential collision
-    Distance nx = tileLength * (sx + ox) + logicalShift.getX();
-    Distance ny = tileLength * (sy + oy) + logicalShift.getY();
+    double nx = tileLength * (sx + ox) + shiftX;
+    double ny = tileLength * (sy + oy) + shiftY;
 
     // The direction of wall to inspect for a potential collision
-    Direction wx = (direction.first  == 1 ? Direction::EAST  : Direction::WEST );
-    Direction wy = (direction.second == 1 ? Direction::NORTH : Direction::SOUTH);
-
-    // The x and y conditions on which to continue looping
-    static std::function<bool(const Distance&, const Distance&)> east = [](const Distance& nx, const Distance& ex) {
-        return nx < ex;
-    };
-    static std::function<bool(const Distance&, const Distance&)> west = [](const Distance& nx, const Distance& ex) {
-        return ex < nx;
-    };
-    static std::function<bool(const Distance&, const Distance&)> north = [](const Distance& ny, const Distance& ey) {
-        return ny < ey;
-    };
-    static std::function<bool(const Distance&, const Distance&)> south = [](const Distance& ny, const Distance& ey) {
-        return ey < ny;
-    };
-    std::function<bool(const Distance&, const Distance&)>* bx = (direction.first  == 1 ? &east  : &west );
-    std::function<bool(const Distance&, const Distance&)>* by = (direction.second == 1 ? &north : &south);
+    const Direction wx = (IX == 1 ? Direction::EAST  : Direction::WEST );
+    const Direction wy = (IY == 1 ? Direction::NORTH : Direction::SOUTH);
+
+    // If the walls aren't transformed, read their bits directly. The wall
+    // crossed when moving from column sx + ox - px to the next one is always
+    // on vertical line sx + ox, and similarly for rows and horizontal lines.
+    int width = walls.getWidth();
+    int height = walls.getHeight();
+    bool isIdentity = walls.getSymmetry().isIdentity();
+    const char* verticalBits = walls.getVerticalWalls().bits();
+    const char* horizontalBits = walls.getHorizontalWalls().bits();
 
     // Loop until we've exhausted the entirety of the ray
-    while ((*bx)(nx, end.getX()) || (*by)(ny, end.getY())) {
+    while ((IX == 1 ? nx < endX : endX < nx) || (IY == 1 ? ny < endY : endY < ny)) {
 
         bool x_first;
-        if (dx == Distance::Meters(0.0)) {
+        if (dx == 0.0) {
             x_first = false;
         }
-        else if (dy == Distance::Meters(0.0)) {
+        else if (dy == 0.0) {
             x_first = true;
         }
         else {
@@ -256,12 +274,21 @@ Coordinate GeometryUtilities::castRay(
             cx = nx;
             int x = sx + ox - px;
             int y = sy + oy - py;
-            if (isOnTileEdge(cy, halfWallWidth, tileLength) ||
-                    (maze.withinMaze(x, y) && maze.getTile(x, y)->isWall(wx))) {
-                return Coordinate::Cartesian(cx, cy);
+
+            // We're within the logical row y, so the offset of cy from the
+            // start of the row stands in for the modulus in isOnTileEdge()
+            if (isOnTileEdge(cy, cy - tileLength * y, halfWallWidth, tileLength)) {
+                return {cx, cy};
             }
-            ox += ix;
-            nx = tileLength * (sx + ox) + logicalShift.getX();
+            if (0 <= x && x < width && 0 <= y && y < height) {
+                if (isIdentity
+                    ? testBit(verticalBits, y * (width + 1) + sx + ox)
+                    : walls.isWall(x, y, wx)) {
+                    return {cx, cy};
+                }
+            }
+            ox += IX;
+            nx = tileLength * (sx + ox) + shiftX;
         }
 
         // y collision will happen first
@@ -270,16 +297,43 @@ Coordinate GeometryUtilities::castRay(
             cy = ny;
             int x = sx + ox - px;
             int y = sy + oy - py;
-            if (isOnTileEdge(cx, halfWallWidth, tileLength) ||
-                    (maze.withinMaze(x, y) && maze.getTile(x, y)->isWall(wy))) {
-                return Coordinate::Cartesian(cx, cy);
+            if (isOnTileEdge(cx, cx - tileLength * x, halfWallWidth, tileLength)) {
+                return {cx, cy};
+            }
+            if (0 <= x && x < width && 0 <= y && y < height) {
+                if (isIdentity
+                    ? testBit(horizontalBits, (sy + oy) * width + x)
+                    : walls.isWall(x, y, wy)) {
+                    return {cx, cy};
+                }
             }
-            oy += iy;
-            ny = tileLength * (sy + oy) + logicalShift.getY();
+            oy += IY;
+            ny = tileLength * (sy + oy) + shiftY;
         }
     }
 
-    return end;
+    return {endX, endY};
+}
+
+bool GeometryUtilities::isOnTileEdge(
+    double position,
+    double offset,
+    double halfWallWidth,
+    double tileLength
+) {
+    // The offset is within half a wall width of [0, tileLength), so it's
+    // equivalent to the modulus, except that std::fmod() keeps the sign of
+    // negative positions, which puts all of them on an edge
+    return (
+        position < 0.0 ||
+        offset < halfWallWidth ||
+        tileLength - halfWallWidth < offset
+    );
+}
+
+bool GeometryUtilities::testBit(const char* bits, int bit) {
+    // Same as QBitArray::testBit(), without the bounds check
+    return (static_cast<uchar>(bits[bit >> 3]) & (1 << (bit & 7))) != 0;
 }
 
 bool GeometryUtilities::isOnTileEdge(
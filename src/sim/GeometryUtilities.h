@@ -1,5 +1,8 @@
 #pragma once
 
+#include <QPair>
+
+#include "BasicMaze.h"
 #include "Maze.h"
 #include "Polygon.h"
 #include "units/Angle.h"
@@ -46,6 +49,32 @@ public:
         const Distance& position,
         const Distance& halfWallWidth,
         const Distance& tileLength);
+
+private:
+
+    // The body of castRay(), on raw doubles and with the direction of the
+    // ray (the signs of its x and y components) known at compile time
+    template<int IX, int IY>
+    static QPair<double, double> castRay(
+        double startX,
+        double startY,
+        double endX,
+        double endY,
+        const BasicMaze& walls,
+        double halfWallWidth,
+        double tileLength);
+
+    // Same as above, but given the offset of position from the start of the
+    // (logical) tile that it's in, rather than computing the modulus
+    static bool isOnTileEdge(
+        double position,
+        double offset,
+        double halfWallWidth,
+        double tileLength);
+
+    // Tests a bit of QBitArray::bits(), without any bounds checks
+    static bool testBit(const char* bits, int bit);
+
 };
 
 } // namespace mms
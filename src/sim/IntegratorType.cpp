@@ -0,0 +1,22 @@
+#include "IntegratorType.h"
+
+#include "ContainerUtilities.h"
+
+namespace mms {
+
+const QMap<IntegratorType, QString>& INTEGRATOR_TYPE_TO_STRING() {
+    static const QMap<IntegratorType, QString> map = {
+        {IntegratorType::EULER, "EULER"},
+        {IntegratorType::ARC, "ARC"},
+        {IntegratorType::RK4, "RK4"},
+    };
+    return map;
+}
+
+const QMap<QString, IntegratorType>& STRING_TO_INTEGRATOR_TYPE() {
+    static const QMap<QString, IntegratorType> map =
+        ContainerUtilities::inverse(INTEGRATOR_TYPE_TO_STRING());
+    return map;
+}
+
+} // namespace mms
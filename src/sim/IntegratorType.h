@@ -0,0 +1,25 @@
+#pragma once
+
+#include <QDebug>
+#include <QMap>
+#include <QString>
+
+#include "ContainerUtilities.h"
+
+namespace mms {
+
+enum class IntegratorType {
+    EULER,
+    ARC,
+    RK4,
+};
+
+const QMap<IntegratorType, QString>& INTEGRATOR_TYPE_TO_STRING();
+const QMap<QString, IntegratorType>& STRING_TO_INTEGRATOR_TYPE();
+
+inline QDebug operator<<(QDebug stream, IntegratorType integratorType) {
+    stream.noquote() << INTEGRATOR_TYPE_TO_STRING().value(integratorType);
+    return stream;
+}
+
+} // namespace mms
@@ -1,6 +1,14 @@
 #include "Map.h"
 
+#include <QElapsedTimer>
+#include <QFontDatabase>
+#include <QOpenGLContext>
+#include <QPainter>
 #include <QPair>
+#include <QPolygonF>
+#include <QVector3D>
+
+#include <cmath>
 
 #include "Assert.h"
 #include "FontImage.h"
@@ -12,6 +20,9 @@
 
 namespace mms {
 
+const double Map::MIN_TILE_PIXELS_FOR_TEXT = 12.0;
+const double Map::MIN_TILE_PIXELS_FOR_CORNERS = 4.0;
+
 Map::Map(QWidget* parent) :
     QOpenGLWidget(parent),
     m_maze(nullptr),
@@ -21,7 +32,15 @@ Map::Map(QWidget* parent) :
     m_windowHeight(0),
     m_layoutType(LayoutType::FULL),
     m_zoomedMapScale(0.1),
-    m_rotateZoomedMap(false) {
+    m_rotateZoomedMap(false),
+    m_uploadedMazeGeometry(nullptr),
+    m_uploadedView(nullptr),
+    m_mouseMeshDirty(false),
+    m_mouseMeshSize(0),
+    m_renderStatsEnabled(false),
+    m_gpuTimerQueriesSupported(false),
+    m_gpuTimerQueryPending{false, false},
+    m_gpuTimerQueryIndex(0) {
     ASSERT_RUNS_JUST_ONCE();
 }
 
@@ -29,13 +48,16 @@ void Map::setMaze(const Maze* maze) {
     ASSERT_TR(m_mouseGraphic == nullptr);
     m_maze = maze;
     m_view = nullptr;
+    m_uploadedMazeGeometry = nullptr;
+    m_uploadedView = nullptr;
 }
 
-void Map::setView(const MazeView* view) {
+void Map::setView(MazeView* view) {
     if (view != nullptr) {
         ASSERT_FA(m_maze == nullptr);
     }
     m_view = view;
+    m_uploadedView = nullptr;
 }
 
 void Map::setMouseGraphic(const MouseGraphic* mouseGraphic) {
@@ -44,6 +66,7 @@ void Map::setMouseGraphic(const MouseGraphic* mouseGraphic) {
         ASSERT_FA(m_view == nullptr);
     }
     m_mouseGraphic = mouseGraphic;
+    m_mouseMeshDirty = true;
 }
 
 void Map::setLayoutType(LayoutType layoutType) {
@@ -58,6 +81,17 @@ void Map::setRotateZoomedMap(bool rotateZoomedMap) {
     m_rotateZoomedMap = rotateZoomedMap;
 }
 
+void Map::setRenderStatsEnabled(bool enabled) {
+    if (enabled && !m_renderStatsEnabled) {
+        m_renderStats.clear();
+    }
+    m_renderStatsEnabled = enabled;
+}
+
+const RenderStats& Map::getRenderStats() const {
+    return m_renderStats;
+}
+
 QVector<QString> Map::getOpenGLVersionInfo() {
     static QVector<QString> openGLVersionInfo;
     if (openGLVersionInfo.empty()) {
@@ -115,6 +149,9 @@ void Map::initializeGL() {
     // Initialize the polygon and texture programs
     initPolygonProgram();
     initTextureProgram();
+
+    // Initialize the GPU timers, if supported
+    initGpuTimerQueries();
 }
 
 void Map::paintGL() {
@@ -125,20 +162,52 @@ void Map::paintGL() {
         return;
     }
 
+    // Only pay for timing when render stats have been requested
+    FrameStats frame;
+    QElapsedTimer timer;
+    qint64 lapStart = 0;
+    auto lap = [&](){
+        qint64 now = timer.nsecsElapsed();
+        Duration elapsed = Duration::Microseconds((now - lapStart) / 1000.0);
+        lapStart = now;
+        return elapsed;
+    };
+    if (m_renderStatsEnabled) {
+        timer.start();
+        beginGpuTimerQuery();
+    }
+
+    // Only the sensor views are rebuilt, the rest of the mouse is static
     Coordinate currentMouseTranslation;
     Angle currentMouseRotation;
+    QMatrix4x4 mousePoseMatrix;
     QVector<TriangleGraphic> mouseBuffer;
     if (m_mouseGraphic != nullptr) {
         auto currentPosition = m_mouseGraphic->getCurrentMousePosition();
         currentMouseTranslation = currentPosition.first;
         currentMouseRotation = currentPosition.second;
-        mouseBuffer = m_mouseGraphic->draw(
+        mousePoseMatrix = m_mouseGraphic->getPoseMatrix(
             currentMouseTranslation,
             currentMouseRotation);
+        mouseBuffer = m_mouseGraphic->drawSensorViews(
+            currentMouseTranslation,
+            currentMouseRotation);
+    }
+    if (m_renderStatsEnabled) {
+        frame.mouseDrawTime = lap();
     }
 
-    // Re-populate both vertex buffer objects
-    repopulateVertexBufferObjects(mouseBuffer);
+    // Upload the changes to the vertex buffer objects, and the mouse mesh if needed
+    frame.bytesUploaded = repopulateVertexBufferObjects(mouseBuffer);
+    if (m_mouseMeshDirty) {
+        frame.bytesUploaded += uploadMouseMesh();
+    }
+    if (m_view->getMazeGeometry() != m_uploadedMazeGeometry) {
+        frame.bytesUploaded += uploadMazeGeometry();
+    }
+    if (m_renderStatsEnabled) {
+        frame.uploadTime = lap();
+    }
 
     // Clear the screen
     glClear(GL_COLOR_BUFFER_BIT);
@@ -146,45 +215,64 @@ void Map::paintGL() {
     // Enable scissoring so that the maps are only draw in specified locations.
     glEnable(GL_SCISSOR_TEST);
 
-    // Determine the starting index of the mouse
-    int mouseTrianglesStartingIndex = m_view->getGraphicCpuBuffer()->size();
+    // Determine the transformation and the visible region, shared by all passes
+    QRect scissor;
+    QMatrix4x4 transformationMatrix = getTransformationMatrix(
+        currentMouseTranslation,
+        currentMouseRotation,
+        &scissor);
+    glScissor(scissor.x(), scissor.y(), scissor.width(), scissor.height());
+
+    // Only draw the chunks of the maze that intersect the visible region
+    QVector<QPair<int, int>> graphicRanges;
+    QVector<QPair<int, int>> textureRanges;
+    cullChunks(transformationMatrix, scissor, &graphicRanges, &textureRanges);
 
     // Draw the tiles
     drawMap(
-        m_layoutType,
-        currentMouseTranslation,
-        currentMouseRotation,
+        transformationMatrix,
         &m_polygonProgram,
-        &m_polygonVAO,
-        0,
-        3 * m_view->getGraphicCpuBuffer()->size()
+        &m_tileVAO,
+        graphicRanges
     );
 
     // Overlay the tile text
     drawMap(
-        m_layoutType,
-        currentMouseTranslation,
-        currentMouseRotation,
+        transformationMatrix,
         &m_textureProgram,
         &m_textureVAO,
-        0,
-        3 * m_view->getTextureCpuBuffer()->size()
+        textureRanges
     );
 
     // Draw the mouse
     drawMap(
-        m_layoutType,
-        currentMouseTranslation,
-        currentMouseRotation,
+        transformationMatrix,
+        &m_polygonProgram,
+        &m_mouseMeshVAO,
+        {{0, 3 * m_mouseMeshSize}},
+        mousePoseMatrix
+    );
+
+    // Draw the sensor views on top of the mouse
+    drawMap(
+        transformationMatrix,
         &m_polygonProgram,
         &m_polygonVAO,
-        3 * m_view->getGraphicCpuBuffer()->size(),
-        3 * mouseBuffer.size()
+        {{0, 3 * mouseBuffer.size()}}
     );
 
     // Disable scissoring so that the glClear can take effect, and so that
     // drawn text isn't clipped at all
     glDisable(GL_SCISSOR_TEST);
+
+    if (m_renderStatsEnabled) {
+        frame.drawCallTime = lap();
+        endGpuTimerQuery();
+        frame.gpuTime = m_lastGpuTime;
+        frame.frameTime = Duration::Microseconds(timer.nsecsElapsed() / 1000.0);
+        m_renderStats.record(frame);
+        drawRenderStatsOverlay();
+    }
 }
 
 void Map::resizeGL(int width, int height) {
@@ -198,11 +286,12 @@ void Map::initPolygonProgram() {
         QOpenGLShader::Vertex,
         R"(
             uniform mat4 transformationMatrix;
+            uniform mat4 modelMatrix;
             attribute vec2 coordinate;
             attribute vec4 inColor;
             varying vec4 outColor;
             void main(void) {
-                gl_Position = transformationMatrix * vec4(coordinate, 0.0, 1.0);
+                gl_Position = transformationMatrix * modelMatrix * vec4(coordinate, 0.0, 1.0);
                 outColor = inColor;
             }
         )"
@@ -219,12 +308,30 @@ void Map::initPolygonProgram() {
     m_polygonProgram.link();
     m_polygonProgram.bind();
 
-    m_polygonVAO.create();
-    m_polygonVAO.bind();
+    initPolygonBuffer(
+        &m_polygonVAO,
+        &m_polygonVBO,
+        QOpenGLBuffer::DynamicDraw);
+    initPolygonBuffer(
+        &m_mouseMeshVAO,
+        &m_mouseMeshVBO,
+        QOpenGLBuffer::StaticDraw);
+    initTileBuffers();
 
-    m_polygonVBO.create();
-    m_polygonVBO.bind();
-    m_polygonVBO.setUsagePattern(QOpenGLBuffer::DynamicDraw);
+    m_polygonProgram.release();
+}
+
+void Map::initPolygonBuffer(
+        QOpenGLVertexArrayObject* vao,
+        QOpenGLBuffer* vbo,
+        QOpenGLBuffer::UsagePattern usagePattern) {
+
+    vao->create();
+    vao->bind();
+
+    vbo->create();
+    vbo->bind();
+    vbo->setUsagePattern(usagePattern);
 
     m_polygonProgram.enableAttributeArray("coordinate");
     m_polygonProgram.setAttributeBuffer(
@@ -244,9 +351,42 @@ void Map::initPolygonProgram() {
         6 * sizeof(double) // stride (bytes between vertices)
     );
 
-    m_polygonVBO.release();
-    m_polygonVAO.release();
-    m_polygonProgram.release();
+    vbo->release();
+    vao->release();
+}
+
+void Map::initTileBuffers() {
+
+    m_tileVAO.create();
+    m_tileVAO.bind();
+
+    m_tilePositionVBO.create();
+    m_tilePositionVBO.bind();
+    m_tilePositionVBO.setUsagePattern(QOpenGLBuffer::StaticDraw);
+    m_polygonProgram.enableAttributeArray("coordinate");
+    m_polygonProgram.setAttributeBuffer(
+        "coordinate", // name
+        GL_DOUBLE, // type
+        0, // offset (bytes)
+        2, // tupleSize (number of elements in the attribute array)
+        2 * sizeof(double) // stride (bytes between vertices)
+    );
+    m_tilePositionVBO.release();
+
+    m_tileColorVBO.create();
+    m_tileColorVBO.bind();
+    m_tileColorVBO.setUsagePattern(QOpenGLBuffer::DynamicDraw);
+    m_polygonProgram.enableAttributeArray("inColor");
+    m_polygonProgram.setAttributeBuffer(
+        "inColor", // name
+        GL_DOUBLE, // type
+        0, // offset (bytes)
+        4, // tupleSize (number of elements in the attribute array)
+        4 * sizeof(double) // stride (bytes between vertices)
+    );
+    m_tileColorVBO.release();
+
+    m_tileVAO.release();
 }
 
 void Map::initTextureProgram() {
@@ -311,47 +451,181 @@ void Map::initTextureProgram() {
     m_polygonProgram.release();
 }
 
-void Map::repopulateVertexBufferObjects(const QVector<TriangleGraphic>& mouseBuffer) {
+void Map::initGpuTimerQueries() {
+    // Timer queries require desktop OpenGL 3.3 or GL_ARB_timer_query
+    if (context()->isOpenGLES()) {
+        return;
+    }
+    if (
+        context()->format().version() < qMakePair(3, 3) &&
+        !context()->hasExtension("GL_ARB_timer_query")
+    ) {
+        return;
+    }
+    m_gpuTimerQueriesSupported =
+        m_gpuTimerQueries[0].create() &&
+        m_gpuTimerQueries[1].create();
+}
 
-    // Overwrite the polygon vertex buffer object data
+void Map::beginGpuTimerQuery() {
+    if (!m_gpuTimerQueriesSupported) {
+        return;
+    }
+    // Harvest the previous result from this query without blocking; if the
+    // GPU hasn't finished yet, the sample is simply dropped
+    QOpenGLTimerQuery* query = &m_gpuTimerQueries[m_gpuTimerQueryIndex];
+    if (
+        m_gpuTimerQueryPending[m_gpuTimerQueryIndex] &&
+        query->isResultAvailable()
+    ) {
+        m_lastGpuTime = Duration::Microseconds(query->waitForResult() / 1000.0);
+    }
+    query->begin();
+}
+
+void Map::endGpuTimerQuery() {
+    if (!m_gpuTimerQueriesSupported) {
+        return;
+    }
+    m_gpuTimerQueries[m_gpuTimerQueryIndex].end();
+    m_gpuTimerQueryPending[m_gpuTimerQueryIndex] = true;
+    m_gpuTimerQueryIndex = 1 - m_gpuTimerQueryIndex;
+}
+
+void Map::drawRenderStatsOverlay() {
+
+    // QPainter manages its own GL state, so release ours first
+    m_polygonProgram.release();
+    m_textureProgram.release();
+
+    QFont font = QFontDatabase::systemFont(QFontDatabase::FixedFont);
+    font.setPointSize(9);
+    QString text = m_renderStats.summary();
+
+    QPainter painter(this);
+    painter.setFont(font);
+    QRect bounds = painter.fontMetrics().boundingRect(
+        QRect(0, 0, width(), height()),
+        Qt::AlignLeft | Qt::AlignTop,
+        text
+    );
+    bounds.translate(
+        Layout::FULL_MAP_BORDER_WIDTH * 2,
+        Layout::FULL_MAP_BORDER_WIDTH * 2
+    );
+    painter.fillRect(bounds.adjusted(-4, -4, 4, 4), QColor(0, 0, 0, 160));
+    painter.setPen(Qt::white);
+    painter.drawText(bounds, Qt::AlignLeft | Qt::AlignTop, text);
+    painter.end();
+
+    // Restore the blend state that QPainter may have changed
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+int Map::repopulateVertexBufferObjects(const QVector<TriangleGraphic>& mouseBuffer) {
+
+    // A newly set view is uploaded in full, after which only the tiles that
+    // changed are written; the positions are uploaded separately
+    bool reallocate = (m_view != m_uploadedView);
+    m_uploadedView = m_view;
+    int bytesUploaded = 0;
+
+    const QVector<TriangleColor>* graphicCpuBuffer = m_view->getGraphicCpuBuffer();
+    bytesUploaded += writeVertexBufferObject(
+        &m_tileColorVBO,
+        graphicCpuBuffer->constData(),
+        sizeof(TriangleColor),
+        graphicCpuBuffer->size(),
+        m_view->takeDirtyGraphicRanges(),
+        reallocate);
+
+    // Overwrite the polygon vertex buffer object data with the mouse
     m_polygonVBO.bind();
-    m_polygonVBO.allocate(sizeof(TriangleGraphic) * (
-        m_view->getGraphicCpuBuffer()->size() +
-        mouseBuffer.size()
-    ));
-    // Write the maze
-    m_polygonVBO.write(
-        0,
-        &(m_view->getGraphicCpuBuffer()->front()),
-        sizeof(TriangleGraphic) * m_view->getGraphicCpuBuffer()->size()
+    m_polygonVBO.allocate(
+        mouseBuffer.constData(),
+        sizeof(TriangleGraphic) * mouseBuffer.size()
     );
-    // Write the mouse
-    if (!mouseBuffer.isEmpty()) {
-        m_polygonVBO.write(
-            sizeof(TriangleGraphic) * m_view->getGraphicCpuBuffer()->size(),
-            &(mouseBuffer.front()),
-            sizeof(TriangleGraphic) * mouseBuffer.size()
-        );
-    }
     m_polygonVBO.release();
+    bytesUploaded += sizeof(TriangleGraphic) * mouseBuffer.size();
+
+    const QVector<TriangleTexture>* textureCpuBuffer = m_view->getTextureCpuBuffer();
+    bytesUploaded += writeVertexBufferObject(
+        &m_textureVBO,
+        textureCpuBuffer->constData(),
+        sizeof(TriangleTexture),
+        textureCpuBuffer->size(),
+        m_view->takeDirtyTextureRanges(),
+        reallocate);
+
+    return bytesUploaded;
+}
 
-    // Overwrite the texture vertex buffer object data
-    m_textureVBO.bind();
-    m_textureVBO.allocate(
-        &(m_view->getTextureCpuBuffer()->front()),
-        sizeof(TriangleTexture) * m_view->getTextureCpuBuffer()->size()
+int Map::writeVertexBufferObject(
+        QOpenGLBuffer* vbo,
+        const void* data,
+        int elementSize,
+        int elementCount,
+        const QVector<QPair<int, int>>& dirtyRanges,
+        bool reallocate) {
+
+    vbo->bind();
+
+    // If the size of the cpu buffer changed then the dirty ranges don't
+    // describe the whole difference, so we have to start over
+    int bytesUploaded = 0;
+    if (reallocate || vbo->size() != elementSize * elementCount) {
+        vbo->allocate(data, elementSize * elementCount);
+        bytesUploaded = elementSize * elementCount;
+    }
+    else {
+        const char* bytes = static_cast<const char*>(data);
+        for (const QPair<int, int>& range : dirtyRanges) {
+            vbo->write(
+                elementSize * range.first,
+                bytes + elementSize * range.first,
+                elementSize * range.second);
+            bytesUploaded += elementSize * range.second;
+        }
+    }
+
+    vbo->release();
+    return bytesUploaded;
+}
+
+int Map::uploadMouseMesh() {
+    m_mouseMeshDirty = false;
+    m_mouseMeshSize = 0;
+    if (m_mouseGraphic == nullptr) {
+        return 0;
+    }
+    const QVector<TriangleGraphic>& mesh = m_mouseGraphic->getStaticMesh();
+    m_mouseMeshSize = mesh.size();
+    m_mouseMeshVBO.bind();
+    m_mouseMeshVBO.allocate(
+        mesh.constData(),
+        sizeof(TriangleGraphic) * mesh.size()
     );
-    m_textureVBO.release();
+    m_mouseMeshVBO.release();
+    return sizeof(TriangleGraphic) * mesh.size();
 }
 
-void Map::drawMap(
-        LayoutType type,
+int Map::uploadMazeGeometry() {
+    m_uploadedMazeGeometry = m_view->getMazeGeometry();
+    const QVector<TrianglePosition>* positions = m_uploadedMazeGeometry->getPositions();
+    m_tilePositionVBO.bind();
+    m_tilePositionVBO.allocate(
+        positions->constData(),
+        sizeof(TrianglePosition) * positions->size()
+    );
+    m_tilePositionVBO.release();
+    return sizeof(TrianglePosition) * positions->size();
+}
+
+QMatrix4x4 Map::getTransformationMatrix(
         const Coordinate& currentMouseTranslation,
         const Angle& currentMouseRotation,
-        QOpenGLShaderProgram* program,
-        QOpenGLVertexArrayObject* vao,
-        int vboStartingIndex,
-        int count) {
+        QRect* scissor) const {
 
     // Get the physical size of the maze (in meters)
     double physicalMazeWidth = P()->wallWidth() + m_maze->getWidth() * (P()->wallWidth() + P()->wallLength());
@@ -359,42 +633,25 @@ void Map::drawMap(
     // TODO: MACK - these should be distances, not doubles
     QPair<double, double> physicalMazeSize = {physicalMazeWidth, physicalMazeHeight};
 
-    // Start using the program and vertex array object
-    program->bind();
-    vao->bind();
+    QVector<float> matrix;
 
-    // If it's the texture program, bind the texture and set the uniform
-    if (program == &m_textureProgram) {
-        glActiveTexture(GL_TEXTURE0);
-        m_textureAtlas->bind();
-        program->setUniformValue("texture", 0);
-    }
-    
     // Render the full map
-    if (type == LayoutType::FULL || m_mouseGraphic == nullptr) {
+    if (m_layoutType == LayoutType::FULL || m_mouseGraphic == nullptr) {
 
         QPair<int, int> fullMapPosition = Layout::getFullMapPosition();
         QPair<int, int> fullMapSize = Layout::getFullMapSize(m_windowWidth, m_windowHeight);
 
         // TODO: MACK
-        auto matrix = TransformationMatrix::getFullMapTransformationMatrix(
+        matrix = TransformationMatrix::getFullMapTransformationMatrix(
             Distance::Meters(P()->wallWidth()),
             physicalMazeSize,
             fullMapPosition,
             fullMapSize,
             {m_windowWidth, m_windowHeight}
         );
-        QMatrix4x4 transformationMatrix(
-            matrix.at(0), matrix.at(1), matrix.at(2), matrix.at(3),
-            matrix.at(4), matrix.at(5), matrix.at(6), matrix.at(7),
-            matrix.at(8), matrix.at(9), matrix.at(10), matrix.at(11),
-            matrix.at(12), matrix.at(13), matrix.at(14), matrix.at(15)
-        );
-
-        glScissor(fullMapPosition.first, fullMapPosition.second, fullMapSize.first, fullMapSize.second);
-        program->setUniformValue("transformationMatrix", transformationMatrix);
-        glDrawArrays(GL_TRIANGLES, vboStartingIndex, count);
-
+        *scissor = QRect(
+            fullMapPosition.first, fullMapPosition.second,
+            fullMapSize.first, fullMapSize.second);
     }
 
     // Render the zoomed map
@@ -404,7 +661,7 @@ void Map::drawMap(
         QPair<int, int> zoomedMapSize = Layout::getZoomedMapSize(m_windowWidth, m_windowHeight);
 
         // TODO: MACK
-        auto matrix2 = TransformationMatrix::getZoomedMapTransformationMatrix(
+        matrix = TransformationMatrix::getZoomedMapTransformationMatrix(
             physicalMazeSize,
             zoomedMapPosition,
             zoomedMapSize,
@@ -416,16 +673,108 @@ void Map::drawMap(
             currentMouseTranslation,
             currentMouseRotation
         );
-        QMatrix4x4 transformationMatrix2(
-            matrix2.at(0), matrix2.at(1), matrix2.at(2), matrix2.at(3),
-            matrix2.at(4), matrix2.at(5), matrix2.at(6), matrix2.at(7),
-            matrix2.at(8), matrix2.at(9), matrix2.at(10), matrix2.at(11),
-            matrix2.at(12), matrix2.at(13), matrix2.at(14), matrix2.at(15)
-        );
+        *scissor = QRect(
+            zoomedMapPosition.first, zoomedMapPosition.second,
+            zoomedMapSize.first, zoomedMapSize.second);
+    }
+
+    return QMatrix4x4(
+        matrix.at(0), matrix.at(1), matrix.at(2), matrix.at(3),
+        matrix.at(4), matrix.at(5), matrix.at(6), matrix.at(7),
+        matrix.at(8), matrix.at(9), matrix.at(10), matrix.at(11),
+        matrix.at(12), matrix.at(13), matrix.at(14), matrix.at(15)
+    );
+}
+
+void Map::cullChunks(
+        const QMatrix4x4& transformationMatrix,
+        const QRect& scissor,
+        QVector<QPair<int, int>>* graphicRanges,
+        QVector<QPair<int, int>>* textureRanges) const {
+
+    // Maps a physical point (in meters) to a window pixel
+    auto toPixels = [&](double x, double y){
+        QVector3D openGlCoordinate = transformationMatrix.map(QVector3D(x, y, 0.0));
+        return QPointF(
+            (openGlCoordinate.x() + 1.0) * 0.5 * m_windowWidth,
+            (openGlCoordinate.y() + 1.0) * 0.5 * m_windowHeight);
+    };
+
+    // Appends a range of triangles as a range of vertices, merging it
+    // with the previous range if they're adjacent in the buffer
+    auto append = [](QVector<QPair<int, int>>* ranges, int start, int count){
+        if (count == 0) {
+            return;
+        }
+        if (!ranges->isEmpty() && ranges->last().first + ranges->last().second == 3 * start) {
+            ranges->last().second += 3 * count;
+        }
+        else {
+            ranges->append({3 * start, 3 * count});
+        }
+    };
+
+    // Determine the level of detail from the on-screen size of a tile
+    double tileLength = P()->wallLength() + P()->wallWidth();
+    QPointF tileVector = toPixels(tileLength, 0.0) - toPixels(0.0, 0.0);
+    double tilePixels = std::sqrt(QPointF::dotProduct(tileVector, tileVector));
+    bool drawText = MIN_TILE_PIXELS_FOR_TEXT <= tilePixels;
+    bool drawCorners = MIN_TILE_PIXELS_FOR_CORNERS <= tilePixels;
+
+    QRectF visible(scissor);
+    for (const BufferChunk& chunk : m_view->getChunks()) {
+
+        // Check the bounding box of the (possibly rotated) chunk
+        QPolygonF corners;
+        corners << toPixels(chunk.minX, chunk.minY) << toPixels(chunk.maxX, chunk.minY)
+                << toPixels(chunk.maxX, chunk.maxY) << toPixels(chunk.minX, chunk.maxY);
+        if (!visible.intersects(corners.boundingRect())) {
+            continue;
+        }
+
+        // The corners of a chunk sit between its walls and its fog
+        if (drawCorners) {
+            append(graphicRanges, chunk.graphicStart, chunk.graphicCount);
+        }
+        else {
+            int cornerEnd = chunk.cornerStart + chunk.cornerCount;
+            append(graphicRanges, chunk.graphicStart, chunk.cornerStart - chunk.graphicStart);
+            append(graphicRanges, cornerEnd, chunk.graphicStart + chunk.graphicCount - cornerEnd);
+        }
+        if (drawText) {
+            append(textureRanges, chunk.textureStart, chunk.textureCount);
+        }
+    }
+}
+
+void Map::drawMap(
+        const QMatrix4x4& transformationMatrix,
+        QOpenGLShaderProgram* program,
+        QOpenGLVertexArrayObject* vao,
+        const QVector<QPair<int, int>>& ranges,
+        const QMatrix4x4& modelMatrix) {
+
+    // Start using the program and vertex array object
+    program->bind();
+    vao->bind();
 
-        glScissor(zoomedMapPosition.first, zoomedMapPosition.second, zoomedMapSize.first, zoomedMapSize.second);
-        program->setUniformValue("transformationMatrix", transformationMatrix2);
-        glDrawArrays(GL_TRIANGLES, vboStartingIndex, count);
+    // If it's the texture program, bind the texture and set the uniform,
+    // otherwise position the geometry with the model matrix
+    if (program == &m_textureProgram) {
+        glActiveTexture(GL_TEXTURE0);
+        m_textureAtlas->bind();
+        program->setUniformValue("texture", 0);
+    }
+    else {
+        program->setUniformValue("modelMatrix", modelMatrix);
+    }
+
+    // Draw each range of vertices
+    program->setUniformValue("transformationMatrix", transformationMatrix);
+    for (const QPair<int, int>& range : ranges) {
+        if (0 < range.second) {
+            glDrawArrays(GL_TRIANGLES, range.first, range.second);
+        }
     }
 
     // If it's the texture program, we should additionally unbind the texture
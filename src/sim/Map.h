@@ -1,18 +1,24 @@
 #pragma once
 
+#include <QMatrix4x4>
 #include <QOpenGLBuffer> 
 #include <QOpenGLDebugLogger>
 #include <QOpenGLFunctions>
 #include <QOpenGLShaderProgram> 
 #include <QOpenGLTexture> 
+#include <QOpenGLTimerQuery>
 #include <QOpenGLVertexArrayObject> 
 #include <QOpenGLWidget>
+#include <QPair>
+#include <QRect>
 #include <QVector>
 
 #include "LayoutType.h"
 #include "Maze.h"
+#include "MazeGeometry.h"
 #include "MazeView.h"
 #include "MouseGraphic.h"
+#include "RenderStats.h"
 #include "TriangleGraphic.h"
 
 namespace mms {
@@ -29,13 +35,17 @@ public:
     Map(QWidget* parent = 0);
 
     void setMaze(const Maze* maze);
-    void setView(const MazeView* view);
+    void setView(MazeView* view);
     void setMouseGraphic(const MouseGraphic* mouseGraphic);
 
     void setLayoutType(LayoutType layoutType);
     void setZoomedMapScale(double zoomedMapScale);
     void setRotateZoomedMap(bool rotateZoomedMap);
 
+    // Enables per-frame render cost collection, shown in a map overlay
+    void setRenderStatsEnabled(bool enabled);
+    const RenderStats& getRenderStats() const;
+
     // Retrieves OpenGL version info
     QVector<QString> getOpenGLVersionInfo();
 
@@ -55,7 +65,7 @@ private:
 
     // No ownership here - only pointers
     const Maze* m_maze;
-    const MazeView* m_view;
+    MazeView* m_view;
     const MouseGraphic* m_mouseGraphic;
 
     // The map's window size, in pixels
@@ -72,27 +82,89 @@ private:
     QOpenGLVertexArrayObject m_polygonVAO;
     QOpenGLBuffer m_polygonVBO;
 
+    // The tile positions are shared by all views of a maze, so they're only
+    // uploaded when the geometry changes; the colors and textures of a view
+    // are uploaded in full when it's set, and after that only the tiles that
+    // have changed are written
+    QOpenGLVertexArrayObject m_tileVAO;
+    QOpenGLBuffer m_tilePositionVBO;
+    QOpenGLBuffer m_tileColorVBO;
+    const MazeGeometry* m_uploadedMazeGeometry;
+    const MazeView* m_uploadedView;
+
+    // The rigid parts of the mouse are uploaded once per mouse graphic and
+    // then positioned by the model matrix, rather than rebuilt every frame
+    QOpenGLVertexArrayObject m_mouseMeshVAO;
+    QOpenGLBuffer m_mouseMeshVBO;
+    bool m_mouseMeshDirty;
+    int m_mouseMeshSize;
+
     // Texture program variables
     QOpenGLTexture* m_textureAtlas;
     QOpenGLShaderProgram m_textureProgram;
     QOpenGLVertexArrayObject m_textureVAO;
     QOpenGLBuffer m_textureVBO;
 
+    // Render cost collection; GPU time is read back from the query issued
+    // two frames earlier so that collecting it never stalls the pipeline
+    bool m_renderStatsEnabled;
+    RenderStats m_renderStats;
+    bool m_gpuTimerQueriesSupported;
+    QOpenGLTimerQuery m_gpuTimerQueries[2];
+    bool m_gpuTimerQueryPending[2];
+    int m_gpuTimerQueryIndex;
+    Duration m_lastGpuTime;
+
     // Initialize the graphics
     void initPolygonProgram();
+    void initPolygonBuffer(
+        QOpenGLVertexArrayObject* vao,
+        QOpenGLBuffer* vbo,
+        QOpenGLBuffer::UsagePattern usagePattern);
+    void initTileBuffers();
     void initTextureProgram();
+    void initGpuTimerQueries();
 
-    // Drawing helper methods
-    void repopulateVertexBufferObjects(
+    // Render cost helper methods
+    void beginGpuTimerQuery();
+    void endGpuTimerQuery();
+    void drawRenderStatsOverlay();
+
+    // Drawing helper methods, returns the number of bytes uploaded
+    int repopulateVertexBufferObjects(
         const QVector<TriangleGraphic>& mouseBuffer);
-    void drawMap(
-        LayoutType type,
+    int uploadMouseMesh();
+    int writeVertexBufferObject(
+        QOpenGLBuffer* vbo,
+        const void* data,
+        int elementSize,
+        int elementCount,
+        const QVector<QPair<int, int>>& dirtyRanges,
+        bool reallocate);
+    int uploadMazeGeometry();
+    QMatrix4x4 getTransformationMatrix(
         const Coordinate& currentMouseTranslation,
         const Angle& currentMouseRotation,
+        QRect* scissor) const;
+    void drawMap(
+        const QMatrix4x4& transformationMatrix,
         QOpenGLShaderProgram* program,
         QOpenGLVertexArrayObject* vao,
-        int vboStartingIndex,
-        int count);
+        const QVector<QPair<int, int>>& ranges,
+        const QMatrix4x4& modelMatrix = QMatrix4x4());
+
+    // Tiles smaller than these sizes, in pixels, are drawn
+    // without text and corners, respectively
+    static const double MIN_TILE_PIXELS_FOR_TEXT;
+    static const double MIN_TILE_PIXELS_FOR_CORNERS;
+
+    // Determines the vertex ranges of the maze chunks that
+    // intersect the visible region, at the appropriate level of detail
+    void cullChunks(
+        const QMatrix4x4& transformationMatrix,
+        const QRect& scissor,
+        QVector<QPair<int, int>>* graphicRanges,
+        QVector<QPair<int, int>>* textureRanges) const;
 };
 
 } // namespace mms
@@ -5,6 +5,9 @@
 
 #include "BasicMaze.h"
 #include "Direction.h"
+#include "MazeCheckReport.h"
+#include "MazeDistances.h"
+#include "MazeSymmetry.h"
 #include "Tile.h"
 
 namespace mms {
@@ -15,15 +18,25 @@ public:
 
     static Maze* fromFile(const QString& path);
     static Maze* fromAlgo(const QByteArray& bytes);
+
+    // Views of the same walls with any symmetry applied share the walls, so
+    // evaluating all eight symmetries of a maze doesn't copy it
+    static Maze* fromWalls(
+        const BasicMaze& basicMaze,
+        const MazeSymmetry& symmetry = MazeSymmetry());
     
     int getWidth() const;
     int getHeight() const;
     bool withinMaze(int x, int y) const;
     const Tile* getTile(int x, int y) const;
+    bool isWall(int x, int y, Direction direction) const;
+    const BasicMaze& getWalls() const;
 
+    const MazeDistances& getDistances() const;
     int getMaximumDistance() const;
     bool isValidMaze() const;
     bool isOfficialMaze() const;
+    const MazeCheckReport& getCheckReport() const;
     bool isCenterTile(int x, int y) const;
     Direction getOptimalStartingDirection() const;
 
@@ -33,22 +46,28 @@ private:
     // a maze using one of the public static methods
     explicit Maze(BasicMaze basicMaze);
 
-    // Vector to hold all of the tiles
-    QVector<QVector<Tile>> m_maze;
+    // The walls of the maze, shared by all of the tiles
+    BasicMaze m_walls;
+
+    // All of the tiles, in the same (row-major) order as the walls
+    QVector<Tile> m_tiles;
+
+    // Distance fields over the walls, e.g., to the center
+    MazeDistances m_distances;
 
     // Cache results to these functions
+    MazeCheckReport m_checkReport;
     bool m_isValidMaze;
     bool m_isOfficialMaze;
 
-    // Initializes all of the tiles of the basic maze
-    static QVector<QVector<Tile>> initializeFromBasicMaze(const BasicMaze& basicMaze);
+    // Initializes all of the tiles from the walls
+    void initializeTiles();
 
-    // Basic maze geometric transformations
-    static BasicMaze mirrorAcrossVertical(const BasicMaze& basicMaze);
-    static BasicMaze rotateCounterClockwise(const BasicMaze& basicMaze);
+    // Applies the maze-mirrored and maze-rotations parameters
+    static BasicMaze withParamSymmetry(const BasicMaze& basicMaze);
 
-    // (Re)set the distance values for the tiles in maze that are reachable from the center
-    static QVector<QVector<Tile>> setTileDistances(QVector<QVector<Tile>> maze);
+    // (Re)set the distance values of the tiles from the center distance field
+    void setTileDistances();
 };
 
 } // namespace mms
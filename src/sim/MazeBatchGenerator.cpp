@@ -0,0 +1,110 @@
+#include "MazeBatchGenerator.h"
+
+#include <QThread>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "MazeChecker.h"
+#include "MazeCorpus.h"
+#include "MazeCorpusWriter.h"
+#include "MazeGenerator.h"
+
+namespace mms {
+
+const int MazeBatchGenerator::ATTEMPTS_PER_THREAD = 64;
+
+int MazeBatchGenerator::generate(
+        const QString& generator,
+        int width,
+        int height,
+        int count,
+        MazeValidity minimumValidity,
+        const QString& outputPath,
+        quint32 seed,
+        int maxAttempts,
+        bool includeMetadata,
+        int threadCount) {
+
+    if (!MazeGenerator::getNames().contains(generator)) {
+        throw std::runtime_error("unknown maze generator");
+    }
+    if (threadCount <= 0) {
+        threadCount = QThread::idealThreadCount();
+    }
+    threadCount = std::max(1, threadCount);
+
+    // Each attempt's maze seed depends only on the batch seed and the
+    // attempt's index, and accepted mazes are written in index order, so the
+    // corpus is the same no matter how many threads generate it
+    MazeCorpusWriter writer(outputPath, std::max(0, count));
+    int attempted = 0;
+    while (writer.size() < writer.capacity() && attempted < maxAttempts) {
+
+        // Attempts are made in rounds, each of which is spread over the
+        // workers and then written out, in order, before the next one starts
+        int roundSize = std::min(maxAttempts - attempted, threadCount * ATTEMPTS_PER_THREAD);
+        std::vector<Attempt> round(roundSize);
+        std::atomic<int> next(0);
+        std::atomic<bool> failed(false);
+        std::exception_ptr error;
+        std::mutex mutex;
+
+        auto work = [&]() {
+            try {
+                int i = 0;
+                while (!failed && (i = next.fetch_add(1)) < roundSize) {
+                    Attempt& attempt = round.at(i);
+                    attempt.maze = MazeGenerator::generate(
+                        generator, width, height, getSeed(seed, attempted + i));
+                    attempt.accepted = minimumValidity <= MazeChecker::checkMaze(attempt.maze);
+                    if (attempt.accepted && includeMetadata) {
+                        attempt.metadata = MazeCorpus::computeMetadata(attempt.maze);
+                    }
+                }
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                failed = true;
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < threadCount; i += 1) {
+            threads.emplace_back(work);
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        for (const Attempt& attempt : round) {
+            if (attempt.accepted && writer.size() < writer.capacity()) {
+                writer.append(attempt.maze, attempt.metadata);
+            }
+        }
+        attempted += roundSize;
+    }
+
+    writer.close();
+    return writer.size();
+}
+
+quint32 MazeBatchGenerator::getSeed(quint32 seed, int index) {
+    std::seed_seq sequence {seed, static_cast<quint32>(index)};
+    std::mt19937 random(sequence);
+    return random();
+}
+
+} // namespace mms
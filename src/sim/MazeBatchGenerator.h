@@ -0,0 +1,59 @@
+#pragma once
+
+#include <QString>
+
+#include "BasicMaze.h"
+#include "MazeCorpusMetadata.h"
+#include "MazeValidity.h"
+
+namespace mms {
+
+// Generates many mazes with one of the built-in generators (see
+// MazeGenerator), using every core, and streams the ones that are at least
+// as valid as required into a corpus file (see MazeCorpusWriter).
+//
+// The seed of each attempt is derived from the batch seed and the attempt's
+// index, and accepted mazes are written in the order of their attempts. So a
+// given batch seed always produces the same corpus, whatever the number of
+// threads.
+class MazeBatchGenerator {
+
+public:
+
+    MazeBatchGenerator() = delete;
+
+    // Returns the number of mazes written, which is less than the requested
+    // count only if the maximum number of attempts was used up first; throws
+    // if the generator fails or the corpus can't be written. A threadCount
+    // of zero uses one thread per core.
+    static int generate(
+        const QString& generator,
+        int width,
+        int height,
+        int count,
+        MazeValidity minimumValidity,
+        const QString& outputPath,
+        quint32 seed,
+        int maxAttempts,
+        bool includeMetadata,
+        int threadCount = 0);
+
+private:
+
+    // The number of attempts each worker makes, on average, per round; large
+    // enough to keep every core busy, small enough to bound the mazes held
+    // in memory at once
+    static const int ATTEMPTS_PER_THREAD;
+
+    struct Attempt {
+        BasicMaze maze;
+        bool accepted = false;
+        MazeCorpusMetadata metadata;
+    };
+
+    // The seed of the maze generated by the attempt with the given index
+    static quint32 getSeed(quint32 seed, int index);
+
+};
+
+} // namespace mms
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "MazeValidity.h"
+
+namespace mms {
+
+// The outcome of every rule checked by MazeChecker. All rules are evaluated
+// for any nonempty maze, so that a report says everything that's wrong.
+struct MazeCheckReport {
+
+    // Required for the maze to be drawable
+    bool isNonempty = false;
+
+    // Required for the maze to be explorable
+    bool isEnclosed = false;
+    bool hasConsistentWalls = false;
+
+    // Required for the maze to be official
+    bool hasNoInaccessibleLocations = false;
+    bool hasThreeStartingWalls = false;
+    bool hasOneEntranceToCenter = false;
+    bool hasHollowCenter = false;
+    bool hasWallAttachedToEachNonCenterPost = false;
+    bool isUnsolvableByWallFollower = false;
+
+    MazeValidity validity = MazeValidity::INVALID;
+};
+
+} // namespace mms
@@ -1,7 +1,6 @@
 #include "MazeChecker.h"
 
 #include <QPair>
-#include <QQueue>
 
 #include "Direction.h"
 #include "MazeUtilities.h"
@@ -9,243 +8,219 @@
 namespace mms {
 
 MazeValidity MazeChecker::checkMaze(const BasicMaze& maze) {
-    bool drawable =  (
-        isNonempty(maze) &&
-        isRectangular(maze)
-    );
-    if (!drawable) {
-        return MazeValidity::INVALID;
-    }
-    bool explorable = (
-        isEnclosed(maze) &&
-        hasConsistentWalls(maze)
-    );
-    if (!explorable) {
-        return MazeValidity::DRAWABLE;
-    }
-    bool official = (
-        hasNoInaccessibleLocations(maze) &&
-        hasThreeStartingWalls(maze) &&
-        hasOneEntranceToCenter(maze) &&
-        hasHollowCenter(maze) &&
-        hasWallAttachedToEachNonCenterPost(maze) &&
-        isUnsolvableByWallFollower(maze)
-    );
-    if (!official) {
-        return MazeValidity::EXPLORABLE;
-    }
-    return MazeValidity::OFFICIAL;
+    return getReport(maze).validity;
 }
 
-bool MazeChecker::isNonempty(const BasicMaze& maze) {
-    return (
-        0 < maze.size() &&
-        0 < maze.at(0).size()
+MazeCheckReport MazeChecker::getReport(const BasicMaze& maze) {
+
+    MazeCheckReport report;
+    report.isNonempty = !maze.isEmpty();
+    if (!report.isNonempty) {
+        return report;
+    }
+
+    int width = maze.getWidth();
+    int height = maze.getHeight();
+
+    // Neighboring tiles share their walls, so only the
+    // file formats that list each tile's walls can disagree
+    report.isEnclosed = isEnclosed(maze);
+    report.hasConsistentWalls = !maze.hasInconsistentWalls();
+
+    // Since the maze is rectangular, we can count instead of recording
+    report.hasNoInaccessibleLocations = (
+        countReachableTiles(maze, maze.getTileIndex(0, 0)) == width * height
     );
-}
 
-bool MazeChecker::isRectangular(const BasicMaze& maze) {
-    for (int i = 0; i < maze.size() - 1; i += 1) {
-        if (maze.at(i).size() != maze.at(i + 1).size()) {
-            return false;
-        }
+    int startingWalls = 0;
+    for (Direction direction : DIRECTIONS()) {
+        startingWalls += maze.isWall(0, 0, direction) ? 1 : 0;
     }
-    return true;
-}
+    report.hasThreeStartingWalls = startingWalls == 3;
 
-bool MazeChecker::isEnclosed(const BasicMaze& maze) {
-    for (int x = 0; x < maze.size(); x += 1) {
-        for (int y = 0; y < maze.at(x).size(); y += 1) {
-            BasicTile walls = maze.at(x).at(y);
-            if (x == 0 && !walls.value(Direction::WEST)) {
-                return false;
-            }
-            if (y == 0 && !walls.value(Direction::SOUTH)) {
-                return false;
-            }
-            if (x == maze.size() - 1 && !walls.value(Direction::EAST)) {
-                return false;
-            }
-            if (y == maze.at(x).size() - 1 && !walls.value(Direction::NORTH)) {
-                return false;
-            }
-        }
+    // Mark the center tiles, so that membership is a single lookup
+    QVector<QPair<int, int>> centerPositions =
+        MazeUtilities::getCenterPositions(width, height);
+    QVector<int> centerTiles;
+    QVector<bool> isCenterTile(width * height, false);
+    for (const auto& position : centerPositions) {
+        int index = maze.getTileIndex(position.first, position.second);
+        centerTiles.append(index);
+        isCenterTile[index] = true;
     }
-    return true;
-}
 
-bool MazeChecker::hasConsistentWalls(const BasicMaze& maze) {
-    for (int x = 0; x < maze.size(); x += 1) {
-        for (int y = 0; y < maze.at(x).size(); y += 1) {
-            BasicTile walls = maze.at(x).at(y);
-            if (
-                0 < x &&
-                walls.value(Direction::WEST) &&
-                !maze.at(x - 1).at(y).value(Direction::EAST)
-            ) {
-                return false;
-            }
-            if (
-                0 < y &&
-                walls.value(Direction::SOUTH) &&
-                !maze.at(x).at(y - 1).value(Direction::NORTH)
-            ) {
-                return false;
-            }
-            if (
-                x < maze.size() - 1 &&
-                walls.value(Direction::EAST) &&
-                !maze.at(x + 1).at(y).value(Direction::WEST)
-            ) {
-                return false;
+    // Count the entrances to the center, and the walls within it
+    int entrances = 0;
+    bool hollow = true;
+    for (int tile : centerTiles) {
+        for (Direction direction : DIRECTIONS()) {
+            int neighbor = maze.getNeighborIndex(tile, direction);
+            bool isWall = maze.isWall(tile, direction);
+            if (neighbor != -1 && isCenterTile.at(neighbor)) {
+                hollow = hollow && !isWall;
             }
-            if (
-                y < maze.at(x).size() - 1 &&
-                walls.value(Direction::NORTH) &&
-                !maze.at(x).at(y + 1).value(Direction::SOUTH)
-            ) {
-                return false;
+            else if (!isWall) {
+                entrances += 1;
             }
         }
     }
-    return true;
-}
+    report.hasOneEntranceToCenter = entrances == 1;
+    report.hasHollowCenter = hollow;
 
-bool MazeChecker::hasNoInaccessibleLocations(const BasicMaze& maze) {
-    QSet<QPair<int, int>> discovered;
-    QQueue<QPair<int, int>> queue;
-    QPair<int, int> start = {0, 0};
-    discovered.insert(start);
-    queue.enqueue(start);
-    while (!queue.isEmpty()) {
-        QPair<int, int> tile = queue.dequeue();
-        for (Direction direction : DIRECTIONS()) {
-            if (maze.at(tile.first).at(tile.second).value(direction)) {
+    // Each interior post is the upper right corner of a tile (x, y) and the
+    // lower left corner of the tile (x + 1, y + 1); only the center post of
+    // a maze with four center tiles may be free-standing
+    QPair<int, int> centerPost = MazeUtilities::getMinPosition(centerPositions);
+    bool attached = true;
+    for (int y = 0; attached && y < height - 1; y += 1) {
+        for (int x = 0; x < width - 1; x += 1) {
+            if (
+                maze.isWall(x, y, Direction::NORTH) ||
+                maze.isWall(x, y, Direction::EAST) ||
+                maze.isWall(x + 1, y + 1, Direction::SOUTH) ||
+                maze.isWall(x + 1, y + 1, Direction::WEST)
+            ) {
                 continue;
             }
-            QPair<int, int> neighbor =
-                MazeUtilities::positionAfterMovingForward(tile, direction);
-            if (!discovered.contains(neighbor)) {
-                discovered.insert(neighbor);
-                queue.enqueue(neighbor);
-            }
-        }
-    }
-    for (int x = 0; x < maze.size(); x += 1) {
-        for (int y = 0; y < maze.at(x).size(); y += 1) {
-            if (!discovered.contains({x, y})) {
-                return false;
+            if (centerTiles.size() == 4 && centerPost == QPair<int, int>(x, y)) {
+                continue;
             }
+            attached = false;
+            break;
         }
     }
-    return true;
+    report.hasWallAttachedToEachNonCenterPost = attached;
+
+    report.isUnsolvableByWallFollower = isUnsolvableByWallFollower(maze, centerTiles);
+
+    // Roll the rules up into a single validity
+    bool explorable = report.isEnclosed && report.hasConsistentWalls;
+    bool official = (
+        explorable &&
+        report.hasNoInaccessibleLocations &&
+        report.hasThreeStartingWalls &&
+        report.hasOneEntranceToCenter &&
+        report.hasHollowCenter &&
+        report.hasWallAttachedToEachNonCenterPost &&
+        report.isUnsolvableByWallFollower
+    );
+    report.validity = (
+        official ? MazeValidity::OFFICIAL :
+        explorable ? MazeValidity::EXPLORABLE :
+        MazeValidity::DRAWABLE
+    );
+    return report;
 }
 
-bool MazeChecker::hasThreeStartingWalls(const BasicMaze& maze) {
-    int count = 0;
-    for (Direction direction : DIRECTIONS()) {
-        if (maze.at(0).at(0).value(direction)) {
-            count += 1;
+QVector<QString> MazeChecker::getFailedRules(const MazeCheckReport& report) {
+    QVector<QPair<bool, QString>> rules {
+        {report.isNonempty, "The maze is empty"},
+        {report.isEnclosed, "The maze is not enclosed by walls"},
+        {report.hasConsistentWalls, "Some neighboring tiles disagree about the wall between them"},
+        {report.hasNoInaccessibleLocations, "Some tiles are inaccessible from the start"},
+        {report.hasThreeStartingWalls, "The starting tile does not have exactly three walls"},
+        {report.hasOneEntranceToCenter, "The center does not have exactly one entrance"},
+        {report.hasHollowCenter, "There are walls inside of the center"},
+        {report.hasWallAttachedToEachNonCenterPost, "Some non-center posts have no walls attached"},
+        {report.isUnsolvableByWallFollower, "The maze can be solved by a wall follower"},
+    };
+    QVector<QString> failed;
+    for (const auto& rule : rules) {
+        if (!rule.first) {
+            failed.append(rule.second);
+        }
+        // Nothing else is evaluated for an empty maze
+        if (!report.isNonempty) {
+            break;
         }
     }
-    return count == 3;
+    return failed;
 }
 
-bool MazeChecker::hasOneEntranceToCenter(const BasicMaze& maze) {
-    const auto& centerPositions =
-        MazeUtilities::getCenterPositions(maze.size(), maze.at(0).size()); 
-    int numberOfEntrances = 0;
-    for (QPair<int, int> tile : centerPositions) {
-        for (Direction direction : DIRECTIONS()) {
-            if (centerPositions.contains(
-                MazeUtilities::positionAfterMovingForward(tile, direction)
-            )) {
-                continue;
-            }
-            if (!maze.at(tile.first).at(tile.second).value(direction)) {
-                numberOfEntrances += 1;
-            }
+bool MazeChecker::isEnclosed(const BasicMaze& maze) {
+    for (int x = 0; x < maze.getWidth(); x += 1) {
+        if (!maze.isWall(x, 0, Direction::SOUTH) ||
+            !maze.isWall(x, maze.getHeight() - 1, Direction::NORTH)) {
+            return false;
         }
     }
-    return numberOfEntrances == 1;
-}
-
-bool MazeChecker::hasHollowCenter(const BasicMaze& maze) {
-    const auto& centerPositions =
-        MazeUtilities::getCenterPositions(maze.size(), maze.at(0).size()); 
-    for (const auto& tile : centerPositions) {
-        for (const auto& other : centerPositions) {
-            for (const auto& direction : DIRECTIONS()) {
-                if (
-                    MazeUtilities::positionAfterMovingForward(tile, direction)
-                    != other
-                ) {
-                    continue;
-                }
-                if (maze.at(tile.first).at(tile.second).value(direction)) {
-                    return false;
-                }
-            }
+    for (int y = 0; y < maze.getHeight(); y += 1) {
+        if (!maze.isWall(0, y, Direction::WEST) ||
+            !maze.isWall(maze.getWidth() - 1, y, Direction::EAST)) {
+            return false;
         }
     }
     return true;
 }
 
-bool MazeChecker::hasWallAttachedToEachNonCenterPost(const BasicMaze& maze) {
-    const auto& centerPositions =
-        MazeUtilities::getCenterPositions(maze.size(), maze.at(0).size());
-    for (int x = 0; x < maze.size() - 1; x += 1) {
-        for (int y = 0; y < maze.at(x).size() - 1; y += 1) {
-            // There is a wall attached
-            if (
-                maze.at(x).at(y).value(Direction::NORTH) ||
-                maze.at(x).at(y).value(Direction::EAST) ||
-                maze.at(x + 1).at(y + 1).value(Direction::SOUTH) ||
-                maze.at(x + 1).at(y + 1).value(Direction::WEST)
-            ) {
+int MazeChecker::countReachableTiles(const BasicMaze& maze, int start) {
+    // Each tile is enqueued at most once, so the queue is a fixed-size array
+    int size = maze.getWidth() * maze.getHeight();
+    QVector<bool> discovered(size, false);
+    QVector<int> queue(size);
+    int head = 0;
+    int tail = 0;
+    discovered[start] = true;
+    queue[tail] = start;
+    tail += 1;
+    while (head < tail) {
+        int tile = queue.at(head);
+        head += 1;
+        for (Direction direction : DIRECTIONS()) {
+            if (maze.isWall(tile, direction)) {
                 continue;
             }
-            // It is the center post
-            QPair<int, int> position = {x, y};
-            if (
-                centerPositions.size() == 4 &&
-                position == MazeUtilities::getMinPosition(centerPositions)
-            ) {
-                continue;
+            int neighbor = maze.getNeighborIndex(tile, direction);
+            if (neighbor != -1 && !discovered.at(neighbor)) {
+                discovered[neighbor] = true;
+                queue[tail] = neighbor;
+                tail += 1;
             }
-            return false; 
         }
     }
-    return true;
+    return tail;
 }
 
-bool MazeChecker::isUnsolvableByWallFollower(const BasicMaze& maze) {
-    const auto& centerPositions =
-        MazeUtilities::getCenterPositions(maze.size(), maze.at(0).size());
-    QSet<QPair<int, int>> reachable;
-    QPair<int, int> start = {0, 0};
-    QPair<int, int> position = start;
+bool MazeChecker::isUnsolvableByWallFollower(
+        const BasicMaze& maze,
+        const QVector<int>& centerTiles) {
+
+    // Leaving the maze is treated like running into a wall
+    auto isBlocked = [&maze](int tile, Direction direction) {
+        return (
+            maze.isWall(tile, direction) ||
+            maze.getNeighborIndex(tile, direction) == -1
+        );
+    };
+
+    // A right-hand wall follower visits each (tile, direction) state at most
+    // once before returning to the start, which bounds the walk
+    int size = maze.getWidth() * maze.getHeight();
+    QVector<bool> reachable(size, false);
+    int start = maze.getTileIndex(0, 0);
+    int position = start;
     Direction direction = Direction::NORTH;
-    do {
-        reachable.insert(position);
+    for (int steps = 0; steps <= 4 * size; steps += 1) {
+        reachable[position] = true;
         Direction oldDirection = direction;
         Direction newDirection = DIRECTION_ROTATE_RIGHT().value(direction);
-        if (!maze.at(position.first).at(position.second).value(newDirection)) {
+        if (!isBlocked(position, newDirection)) {
             direction = newDirection;
         }
-        while (maze.at(position.first).at(position.second).value(direction)) {
+        while (isBlocked(position, direction)) {
             direction = DIRECTION_ROTATE_LEFT().value(direction);
             if (direction == oldDirection) {
                 // We're surrounded by walls
-                return !centerPositions.contains(position);
+                return !centerTiles.contains(position);
             }
         }
-        position =
-            MazeUtilities::positionAfterMovingForward(position, direction);
+        position = maze.getNeighborIndex(position, direction);
+        if (position == start) {
+            break;
+        }
     }
-    while (position != start);
-    for (const auto& tile : centerPositions) {
-        if (reachable.contains(tile)) {
+    for (int tile : centerTiles) {
+        if (reachable.at(tile)) {
             return false;
         }
     }
@@ -1,19 +1,14 @@
 #pragma once
 
+#include <QString>
+#include <QVector>
+
 #include "BasicMaze.h"
+#include "MazeCheckReport.h"
+#include "MazeValidity.h"
 
 namespace mms {
 
-enum class MazeValidity {
-    INVALID,
-    // Maze can be rendered
-    DRAWABLE,
-    // Maze be explored by a mouse
-    EXPLORABLE,
-    // Maze follows official guidelines
-    OFFICIAL,
-};
-
 class MazeChecker {
 
 public:
@@ -21,18 +16,20 @@ public:
     MazeChecker() = delete;
     static MazeValidity checkMaze(const BasicMaze& maze);
 
+    // Evaluates all of the rules in a single pass over the walls, plus a
+    // breadth-first search and a wall-follower walk on fixed-size arrays
+    static MazeCheckReport getReport(const BasicMaze& maze);
+
+    // Human readable descriptions of the rules that the maze failed
+    static QVector<QString> getFailedRules(const MazeCheckReport& report);
+
 private:
 
-    static bool isNonempty(const BasicMaze& maze);
-    static bool isRectangular(const BasicMaze& maze);
     static bool isEnclosed(const BasicMaze& maze);
-    static bool hasConsistentWalls(const BasicMaze& maze);
-    static bool hasNoInaccessibleLocations(const BasicMaze& maze);
-    static bool hasThreeStartingWalls(const BasicMaze& maze);
-    static bool hasOneEntranceToCenter(const BasicMaze& maze);
-    static bool hasHollowCenter(const BasicMaze& maze);
-    static bool hasWallAttachedToEachNonCenterPost(const BasicMaze& maze);
-    static bool isUnsolvableByWallFollower(const BasicMaze& maze);
+    static int countReachableTiles(const BasicMaze& maze, int start);
+    static bool isUnsolvableByWallFollower(
+        const BasicMaze& maze,
+        const QVector<int>& centerTiles);
 
 };
 
@@ -0,0 +1,284 @@
+#include "MazeCorpus.h"
+
+#include <QtEndian>
+
+#include <climits>
+#include <cstring>
+
+#include "Assert.h"
+#include "Maze.h"
+#include "MazeFileUtilities.h"
+
+namespace mms {
+
+const QByteArray MazeCorpus::MAGIC = "MMSC";
+const int MazeCorpus::VERSION = 1;
+const int MazeCorpus::HEADER_SIZE = 16;
+const int MazeCorpus::ENTRY_HEADER_SIZE = 12;
+const int MazeCorpus::FLAG_INCONSISTENT_WALLS = 1 << 0;
+const int MazeCorpus::FLAG_HAS_METADATA = 1 << 1;
+
+MazeCorpus::MazeCorpus(const QString& path) : m_file(path), m_size(0) {
+    if (!m_file.open(QIODevice::ReadOnly)) {
+        throw std::runtime_error("file doesn't exist");
+    }
+    qint64 size = m_file.size();
+    if (INT_MAX < size) {
+        throw std::runtime_error("maze corpus too large");
+    }
+    uchar* data = (0 < size ? m_file.map(0, size) : nullptr);
+    if (data == nullptr) {
+        m_bytes = m_file.readAll();
+    }
+    else {
+        m_bytes = QByteArray::fromRawData(
+            reinterpret_cast<const char*>(data),
+            static_cast<int>(size));
+    }
+    initialize();
+}
+
+MazeCorpus::MazeCorpus(const QByteArray& bytes) : m_bytes(bytes), m_size(0) {
+    initialize();
+}
+
+bool MazeCorpus::isCorpus(const QByteArray& bytes) {
+    return HEADER_SIZE <= bytes.size() && bytes.startsWith(MAGIC);
+}
+
+int MazeCorpus::size() const {
+    return m_size;
+}
+
+int MazeCorpus::getWidth(int index) const {
+    return qFromLittleEndian<quint16>(getEntry(index));
+}
+
+int MazeCorpus::getHeight(int index) const {
+    return qFromLittleEndian<quint16>(getEntry(index) + 2);
+}
+
+BasicMaze MazeCorpus::getMaze(int index) const {
+    const uchar* entry = getEntry(index);
+    int width = qFromLittleEndian<quint16>(entry);
+    int height = qFromLittleEndian<quint16>(entry + 2);
+    const char* horizontal = reinterpret_cast<const char*>(entry + ENTRY_HEADER_SIZE);
+    const char* vertical = horizontal + getPackedSize(getHorizontalWallCount(width, height));
+    return BasicMaze::fromPackedWalls(
+        width,
+        height,
+        horizontal,
+        vertical,
+        (entry[4] & FLAG_INCONSISTENT_WALLS) != 0);
+}
+
+MazeCorpusMetadata MazeCorpus::getMetadata(int index) const {
+    const uchar* entry = getEntry(index);
+    MazeCorpusMetadata metadata;
+    if ((entry[4] & FLAG_HAS_METADATA) == 0) {
+        return metadata;
+    }
+    metadata.isPresent = true;
+    metadata.validity = static_cast<MazeValidity>(entry[5]);
+    metadata.optimalStartingDirection = DIRECTIONS().at(entry[6]);
+    metadata.maximumDistance = qFromLittleEndian<qint32>(entry + 8);
+    return metadata;
+}
+
+MazeCorpusMetadata MazeCorpus::computeMetadata(const BasicMaze& maze) {
+    Maze* fullMaze = Maze::fromWalls(maze);
+    MazeCorpusMetadata metadata;
+    metadata.isPresent = true;
+    metadata.validity = fullMaze->getCheckReport().validity;
+    metadata.maximumDistance = fullMaze->getMaximumDistance();
+    metadata.optimalStartingDirection = fullMaze->getOptimalStartingDirection();
+    delete fullMaze;
+    return metadata;
+}
+
+QByteArray MazeCorpus::serialize(
+        const QVector<BasicMaze>& mazes,
+        bool includeMetadata) {
+
+    // Transformed mazes are packed in their own coordinates
+    QVector<BasicMaze> normalized;
+    normalized.reserve(mazes.size());
+    for (const BasicMaze& maze : mazes) {
+        normalized.append(maze.normalized());
+    }
+
+    // Compute the size of the whole file up front, so that we only have to
+    // allocate the output buffer once
+    qint64 size = HEADER_SIZE + 8 * normalized.size();
+    for (const BasicMaze& maze : normalized) {
+        size += getEntrySize(maze);
+    }
+    if (INT_MAX < size) {
+        throw std::runtime_error("maze corpus too large");
+    }
+    QByteArray bytes(static_cast<int>(size), '\0');
+    uchar* data = reinterpret_cast<uchar*>(bytes.data());
+    writeHeader(normalized.size(), data);
+
+    // Index and entries
+    qint64 offset = HEADER_SIZE + 8 * normalized.size();
+    for (int i = 0; i < normalized.size(); i += 1) {
+        const BasicMaze& maze = normalized.at(i);
+        qToLittleEndian<quint64>(offset, data + HEADER_SIZE + 8 * i);
+        writeEntry(
+            maze,
+            includeMetadata ? computeMetadata(maze) : MazeCorpusMetadata(),
+            data + offset);
+        offset += getEntrySize(maze);
+    }
+
+    return bytes;
+}
+
+void MazeCorpus::convert(
+        const QStringList& inputPaths,
+        const QString& outputPath,
+        bool includeMetadata) {
+    QVector<BasicMaze> mazes;
+    mazes.reserve(inputPaths.size());
+    for (const QString& path : inputPaths) {
+        mazes.append(MazeFileUtilities::load(path));
+    }
+    QByteArray bytes = serialize(mazes, includeMetadata);
+    QFile file(outputPath);
+    if (!file.open(QIODevice::WriteOnly) || file.write(bytes) != bytes.size()) {
+        throw std::runtime_error("unable to write file");
+    }
+}
+
+QString MazeCorpus::getEntryPath(const QString& path, int index) {
+    return path + "#" + QString::number(index);
+}
+
+bool MazeCorpus::parseEntryPath(const QString& entryPath, QString* path, int* index) {
+    int separator = entryPath.lastIndexOf('#');
+    if (separator == -1) {
+        return false;
+    }
+    bool ok = false;
+    int value = entryPath.mid(separator + 1).toInt(&ok);
+    if (!ok || value < 0) {
+        return false;
+    }
+    *path = entryPath.left(separator);
+    *index = value;
+    return true;
+}
+
+void MazeCorpus::initialize() {
+    if (!isCorpus(m_bytes)) {
+        throw std::runtime_error("not a maze corpus");
+    }
+    const uchar* data = reinterpret_cast<const uchar*>(m_bytes.constData());
+    if (qFromLittleEndian<quint16>(data + 4) != VERSION) {
+        throw std::runtime_error("unsupported maze corpus version");
+    }
+    quint32 count = qFromLittleEndian<quint32>(data + 8);
+    if (static_cast<quint32>(m_bytes.size() - HEADER_SIZE) / 8 < count) {
+        throw std::runtime_error("truncated maze corpus index");
+    }
+    m_size = static_cast<int>(count);
+}
+
+const uchar* MazeCorpus::getEntry(int index) const {
+    if (index < 0 || m_size <= index) {
+        throw std::runtime_error("maze corpus index out of range");
+    }
+    const uchar* data = reinterpret_cast<const uchar*>(m_bytes.constData());
+    quint64 offset = qFromLittleEndian<quint64>(data + HEADER_SIZE + 8 * index);
+    quint64 size = m_bytes.size();
+    if (size < ENTRY_HEADER_SIZE || size - ENTRY_HEADER_SIZE < offset) {
+        throw std::runtime_error("truncated maze corpus entry");
+    }
+    const uchar* entry = data + offset;
+    int width = qFromLittleEndian<quint16>(entry);
+    int height = qFromLittleEndian<quint16>(entry + 2);
+    qint64 horizontalWallCount = getHorizontalWallCount(width, height);
+    qint64 verticalWallCount = getVerticalWallCount(width, height);
+    if (INT_MAX < horizontalWallCount || INT_MAX < verticalWallCount) {
+        throw std::runtime_error("maze corpus entry too large");
+    }
+    quint64 wallsSize =
+        getPackedSize(horizontalWallCount) +
+        getPackedSize(verticalWallCount);
+    if (size - ENTRY_HEADER_SIZE - offset < wallsSize) {
+        throw std::runtime_error("truncated maze corpus entry");
+    }
+
+    // Reject metadata that doesn't name a validity or direction
+    if ((entry[4] & FLAG_HAS_METADATA) != 0) {
+        if (static_cast<int>(MazeValidity::OFFICIAL) < entry[5]) {
+            throw std::runtime_error("invalid maze corpus entry validity");
+        }
+        if (DIRECTIONS().size() <= entry[6]) {
+            throw std::runtime_error("invalid maze corpus entry direction");
+        }
+    }
+    return entry;
+}
+
+void MazeCorpus::writeHeader(int count, uchar* data) {
+    memset(data, 0, HEADER_SIZE);
+    memcpy(data, MAGIC.constData(), MAGIC.size());
+    qToLittleEndian<quint16>(VERSION, data + 4);
+    qToLittleEndian<quint32>(count, data + 8);
+}
+
+qint64 MazeCorpus::getEntrySize(const BasicMaze& maze) {
+    int width = maze.getWidth();
+    int height = maze.getHeight();
+    return (
+        ENTRY_HEADER_SIZE +
+        getPackedSize(getHorizontalWallCount(width, height)) +
+        getPackedSize(getVerticalWallCount(width, height))
+    );
+}
+
+void MazeCorpus::writeEntry(
+        const BasicMaze& maze,
+        const MazeCorpusMetadata& metadata,
+        uchar* entry) {
+    ASSERT_TR(maze.getSymmetry().isIdentity());
+    memset(entry, 0, ENTRY_HEADER_SIZE);
+    qToLittleEndian<quint16>(maze.getWidth(), entry);
+    qToLittleEndian<quint16>(maze.getHeight(), entry + 2);
+    uchar flags = 0;
+    if (maze.hasInconsistentWalls()) {
+        flags |= FLAG_INCONSISTENT_WALLS;
+    }
+    if (metadata.isPresent) {
+        flags |= FLAG_HAS_METADATA;
+        entry[5] = static_cast<uchar>(metadata.validity);
+        entry[6] = static_cast<uchar>(
+            DIRECTIONS().indexOf(metadata.optimalStartingDirection));
+        qToLittleEndian<qint32>(metadata.maximumDistance, entry + 8);
+    }
+    entry[4] = flags;
+
+    // QBitArray keeps the unused bits of its last byte cleared, so the
+    // packed walls can be copied out verbatim
+    uchar* walls = entry + ENTRY_HEADER_SIZE;
+    qint64 horizontalSize = getPackedSize(maze.getHorizontalWalls().size());
+    memcpy(walls, maze.getHorizontalWalls().bits(), horizontalSize);
+    qint64 verticalSize = getPackedSize(maze.getVerticalWalls().size());
+    memcpy(walls + horizontalSize, maze.getVerticalWalls().bits(), verticalSize);
+}
+
+qint64 MazeCorpus::getPackedSize(qint64 bits) {
+    return (bits + 7) / 8;
+}
+
+qint64 MazeCorpus::getHorizontalWallCount(int width, int height) {
+    return static_cast<qint64>(width) * (height + 1);
+}
+
+qint64 MazeCorpus::getVerticalWallCount(int width, int height) {
+    return static_cast<qint64>(width + 1) * height;
+}
+
+} // namespace mms
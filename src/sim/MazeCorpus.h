@@ -0,0 +1,102 @@
+#pragma once
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include "BasicMaze.h"
+#include "MazeCorpusMetadata.h"
+
+namespace mms {
+
+// A single file containing many mazes, designed to be memory mapped and read
+// without any parsing. All integers are little-endian. The layout is:
+//
+//   header:  "MMSC", u16 version, u16 reserved, u32 count, u32 reserved
+//   index:   count x u64 absolute offsets of the entries
+//   entries: u16 width, u16 height, u8 flags, u8 validity,
+//            u8 optimal starting direction, u8 reserved,
+//            i32 maximum distance, followed by the horizontal and then the
+//            vertical walls, packed as in QBitArray::bits()
+//
+// The metadata fields of an entry are only meaningful if its flags say so.
+class MazeCorpus {
+
+public:
+
+    // Memory maps the corpus file at the given path; throws on failure
+    explicit MazeCorpus(const QString& path);
+
+    // Reads a corpus that's already in memory; the bytes are not copied
+    explicit MazeCorpus(const QByteArray& bytes);
+
+    // Whether or not the bytes start with the corpus header
+    static bool isCorpus(const QByteArray& bytes);
+
+    int size() const;
+    int getWidth(int index) const;
+    int getHeight(int index) const;
+    BasicMaze getMaze(int index) const;
+    MazeCorpusMetadata getMetadata(int index) const;
+
+    // Computes the metadata that's stored alongside a maze
+    static MazeCorpusMetadata computeMetadata(const BasicMaze& maze);
+
+    // Packs the mazes into a corpus, optionally computing their metadata
+    static QByteArray serialize(
+        const QVector<BasicMaze>& mazes,
+        bool includeMetadata);
+
+    // Loads each of the maze files (in any format) and writes them to a
+    // single corpus file; throws if any of them can't be loaded or written
+    static void convert(
+        const QStringList& inputPaths,
+        const QString& outputPath,
+        bool includeMetadata);
+
+    // Individual mazes of a corpus are addressed as "<path>#<index>"
+    static QString getEntryPath(const QString& path, int index);
+    static bool parseEntryPath(const QString& entryPath, QString* path, int* index);
+
+private:
+
+    // Streams entries into a corpus file, using the same packing
+    friend class MazeCorpusWriter;
+
+    static const QByteArray MAGIC;
+    static const int VERSION;
+    static const int HEADER_SIZE;
+    static const int ENTRY_HEADER_SIZE;
+
+    // Entry flags
+    static const int FLAG_INCONSISTENT_WALLS;
+    static const int FLAG_HAS_METADATA;
+
+    // Keeps the mapping alive, if the corpus was read from a file
+    QFile m_file;
+    QByteArray m_bytes;
+    int m_size;
+
+    void initialize();
+
+    // Returns a pointer to the (bounds checked) entry at the given index
+    const uchar* getEntry(int index) const;
+
+    // Packing helpers; entries must be normalized (see BasicMaze::normalized)
+    static void writeHeader(int count, uchar* data);
+    static qint64 getEntrySize(const BasicMaze& maze);
+    static void writeEntry(
+        const BasicMaze& maze,
+        const MazeCorpusMetadata& metadata,
+        uchar* entry);
+
+    // Sizes are computed in 64 bits, since the dimensions of an entry are
+    // only bounded by its 16 bit fields
+    static qint64 getPackedSize(qint64 bits);
+    static qint64 getHorizontalWallCount(int width, int height);
+    static qint64 getVerticalWallCount(int width, int height);
+};
+
+} // namespace mms
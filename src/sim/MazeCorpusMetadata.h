@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Direction.h"
+#include "MazeValidity.h"
+
+namespace mms {
+
+// Precomputed properties of a maze in a corpus file, so that clients can
+// filter or sort the mazes without constructing them
+struct MazeCorpusMetadata {
+    bool isPresent = false;
+    MazeValidity validity = MazeValidity::INVALID;
+    int maximumDistance = 0;
+    Direction optimalStartingDirection = Direction::NORTH;
+};
+
+} // namespace mms
@@ -0,0 +1,89 @@
+#include "MazeCorpusWriter.h"
+
+#include <QByteArray>
+#include <QtEndian>
+
+#include "MazeCorpus.h"
+
+namespace mms {
+
+MazeCorpusWriter::MazeCorpusWriter(const QString& path, int capacity) :
+        m_file(path),
+        m_capacity(capacity),
+        m_offset(0) {
+    if (capacity < 0) {
+        throw std::runtime_error("negative maze corpus capacity");
+    }
+    if (!m_file.open(QIODevice::WriteOnly)) {
+        throw std::runtime_error("unable to open file");
+    }
+    m_offsets.reserve(capacity);
+
+    // Reserve the space for the header and the index
+    m_offset = MazeCorpus::HEADER_SIZE + 8 * static_cast<quint64>(capacity);
+    if (!m_file.resize(m_offset) || !m_file.seek(m_offset)) {
+        throw std::runtime_error("unable to write file");
+    }
+}
+
+MazeCorpusWriter::~MazeCorpusWriter() {
+    if (m_file.isOpen()) {
+        try {
+            close();
+        }
+        catch (const std::exception&) {
+            // Destructors must not throw; call close() to see write errors
+        }
+    }
+}
+
+int MazeCorpusWriter::size() const {
+    return m_offsets.size();
+}
+
+int MazeCorpusWriter::capacity() const {
+    return m_capacity;
+}
+
+void MazeCorpusWriter::append(
+        const BasicMaze& maze,
+        const MazeCorpusMetadata& metadata) {
+    if (!m_file.isOpen()) {
+        throw std::runtime_error("maze corpus is closed");
+    }
+    if (m_capacity <= m_offsets.size()) {
+        throw std::runtime_error("maze corpus is full");
+    }
+    BasicMaze normalized = maze.normalized();
+    QByteArray entry(static_cast<int>(MazeCorpus::getEntrySize(normalized)), '\0');
+    MazeCorpus::writeEntry(
+        normalized,
+        metadata,
+        reinterpret_cast<uchar*>(entry.data()));
+    if (m_file.write(entry) != entry.size()) {
+        throw std::runtime_error("unable to write file");
+    }
+    m_offsets.append(m_offset);
+    m_offset += entry.size();
+}
+
+void MazeCorpusWriter::close() {
+    if (!m_file.isOpen()) {
+        return;
+    }
+    QByteArray head(MazeCorpus::HEADER_SIZE + 8 * m_offsets.size(), '\0');
+    uchar* data = reinterpret_cast<uchar*>(head.data());
+    MazeCorpus::writeHeader(m_offsets.size(), data);
+    for (int i = 0; i < m_offsets.size(); i += 1) {
+        qToLittleEndian<quint64>(
+            m_offsets.at(i),
+            data + MazeCorpus::HEADER_SIZE + 8 * i);
+    }
+    bool success = m_file.seek(0) && m_file.write(head) == head.size();
+    m_file.close();
+    if (!success) {
+        throw std::runtime_error("unable to write file");
+    }
+}
+
+} // namespace mms
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <QFile>
+#include <QString>
+#include <QVector>
+
+#include "BasicMaze.h"
+#include "MazeCorpusMetadata.h"
+
+namespace mms {
+
+// Streams mazes into a corpus file (see MazeCorpus) as they're produced, so
+// that the whole corpus never has to be held in memory. The index is reserved
+// up front for a fixed capacity; the header and the index are filled in when
+// the writer is closed, so a corpus with fewer entries than its capacity is
+// still valid (the unused index slots are simply never read).
+class MazeCorpusWriter {
+
+public:
+
+    // Opens the file for writing; throws on failure
+    MazeCorpusWriter(const QString& path, int capacity);
+
+    // Closes the writer, if it hasn't been closed already
+    ~MazeCorpusWriter();
+
+    int size() const;
+    int capacity() const;
+
+    // Appends a maze, with metadata if present; throws if the corpus is
+    // already full or closed, or if the write fails
+    void append(
+        const BasicMaze& maze,
+        const MazeCorpusMetadata& metadata = MazeCorpusMetadata());
+
+    // Writes the header and index; throws if the write fails
+    void close();
+
+private:
+
+    QFile m_file;
+    int m_capacity;
+    QVector<quint64> m_offsets;
+    quint64 m_offset;
+
+};
+
+} // namespace mms
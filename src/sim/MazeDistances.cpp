@@ -0,0 +1,155 @@
+#include "MazeDistances.h"
+
+#include <algorithm>
+
+#include "Assert.h"
+#include "MazeUtilities.h"
+
+namespace mms {
+
+MazeDistances::MazeDistances(const BasicMaze* walls) :
+        m_walls(walls),
+        m_centerField(nullptr) {
+    ASSERT_FA(m_walls == nullptr);
+}
+
+const QVector<int>& MazeDistances::getCenterField() const {
+    if (m_centerField == nullptr) {
+        m_centerField = &getField(MazeUtilities::getCenterPositions(
+            m_walls->getWidth(),
+            m_walls->getHeight()));
+    }
+    return *m_centerField;
+}
+
+const QVector<int>& MazeDistances::getOriginField() const {
+    if (m_walls->isEmpty()) {
+        return getFieldForIndices({});
+    }
+    return getFieldForIndices({m_walls->getTileIndex(0, 0)});
+}
+
+const QVector<int>& MazeDistances::getField(
+        const QVector<QPair<int, int>>& goals) const {
+    QVector<int> indices;
+    for (const auto& goal : goals) {
+        if (m_walls->withinMaze(goal.first, goal.second)) {
+            indices.append(m_walls->getTileIndex(goal.first, goal.second));
+        }
+    }
+    return getFieldForIndices(indices);
+}
+
+int MazeDistances::getDistanceToCenter(int x, int y) const {
+    return getCenterField().at(m_walls->getTileIndex(x, y));
+}
+
+int MazeDistances::getMaximumDistanceToCenter() const {
+    const QVector<int>& field = getCenterField();
+    if (field.isEmpty()) {
+        return 0;
+    }
+    return std::max(0, *std::max_element(field.begin(), field.end()));
+}
+
+void MazeDistances::onWallChanged(int x, int y, Direction direction) {
+    int index = m_walls->getTileIndex(x, y);
+    int neighbor = m_walls->getNeighborIndex(index, direction);
+    if (neighbor == -1) {
+        // Walls on the edge of the maze never lie on a path
+        return;
+    }
+    bool isWall = m_walls->isWall(index, direction);
+    for (auto it = m_fields.begin(); it != m_fields.end(); ++it) {
+        QVector<int>& field = it.value();
+        int distance = field.at(index);
+        int neighborDistance = field.at(neighbor);
+        if (!isWall) {
+            // Removing a wall can only shorten paths, starting at its ends
+            relax(&field, index);
+            relax(&field, neighbor);
+        }
+        else if (distance != neighborDistance) {
+            // Adding a wall only matters if a shortest path went through it
+            field = search(it.key());
+        }
+    }
+}
+
+void MazeDistances::clear() {
+    m_fields.clear();
+    m_centerField = nullptr;
+}
+
+const QVector<int>& MazeDistances::getFieldForIndices(const QVector<int>& goals) const {
+    QVector<int> key = goals;
+    std::sort(key.begin(), key.end());
+    key.erase(std::unique(key.begin(), key.end()), key.end());
+    auto it = m_fields.find(key);
+    if (it == m_fields.end()) {
+        it = m_fields.insert(key, search(key));
+    }
+    return it.value();
+}
+
+QVector<int> MazeDistances::search(const QVector<int>& goals) const {
+
+    // The queue for the BFS, as a flat array of tile indices; each tile is
+    // enqueued at most once, so it never needs to grow
+    int numTiles = m_walls->getWidth() * m_walls->getHeight();
+    QVector<int> field(numTiles, -1);
+    QVector<int> discovered(numTiles);
+    int head = 0;
+    int tail = 0;
+
+    // All of the goals are sources of the search
+    for (int index : goals) {
+        field[index] = 0;
+        discovered[tail] = index;
+        tail += 1;
+    }
+
+    while (head < tail) {
+        int index = discovered.at(head);
+        head += 1;
+        for (Direction direction : DIRECTIONS()) {
+            if (m_walls->isWall(index, direction)) {
+                continue;
+            }
+            int neighbor = m_walls->getNeighborIndex(index, direction);
+            if (neighbor != -1 && field.at(neighbor) == -1) {
+                field[neighbor] = field.at(index) + 1;
+                discovered[tail] = neighbor;
+                tail += 1;
+            }
+        }
+    }
+
+    return field;
+}
+
+void MazeDistances::relax(QVector<int>* field, int index) const {
+    if (field->at(index) == -1) {
+        return;
+    }
+    QVector<int> queue {index};
+    for (int head = 0; head < queue.size(); head += 1) {
+        int current = queue.at(head);
+        int distance = field->at(current) + 1;
+        for (Direction direction : DIRECTIONS()) {
+            if (m_walls->isWall(current, direction)) {
+                continue;
+            }
+            int neighbor = m_walls->getNeighborIndex(current, direction);
+            if (
+                neighbor != -1 &&
+                (field->at(neighbor) == -1 || distance < field->at(neighbor))
+            ) {
+                (*field)[neighbor] = distance;
+                queue.append(neighbor);
+            }
+        }
+    }
+}
+
+} // namespace mms
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <QMap>
+#include <QPair>
+#include <QVector>
+
+#include "BasicMaze.h"
+#include "Direction.h"
+
+namespace mms {
+
+// Computes and caches BFS distance fields over the walls of a maze. A field
+// holds, for every tile in row-major order (see BasicMaze::getTileIndex), the
+// number of moves to the nearest tile of a set of goals, or -1 if no goal is
+// reachable from that tile. Each goal set is only searched once; clients that
+// change the walls report each change so that the cached fields are updated
+// incrementally instead of being recomputed from scratch.
+class MazeDistances {
+
+public:
+
+    // The walls are owned by the caller, and must outlive this object
+    explicit MazeDistances(const BasicMaze* walls);
+
+    // The fields for the center of the maze and for the starting tile
+    const QVector<int>& getCenterField() const;
+    const QVector<int>& getOriginField() const;
+
+    // The field for an arbitrary set of goal tiles (multi-source BFS)
+    const QVector<int>& getField(const QVector<QPair<int, int>>& goals) const;
+
+    // Convenience accessors for a single tile of the center field
+    int getDistanceToCenter(int x, int y) const;
+    int getMaximumDistanceToCenter() const;
+
+    // Must be called after the wall on the given side of the tile changes
+    void onWallChanged(int x, int y, Direction direction);
+
+    // Drops all of the cached fields
+    void clear();
+
+private:
+
+    const BasicMaze* m_walls;
+
+    // Cached fields, keyed by their sorted goal tile indices
+    mutable QMap<QVector<int>, QVector<int>> m_fields;
+
+    // The center field, which is read for every tile, points into the cache
+    // so that reading it doesn't rebuild and look up its key each time; the
+    // nodes of a QMap stay put until they're removed
+    mutable const QVector<int>* m_centerField;
+
+    const QVector<int>& getFieldForIndices(const QVector<int>& goals) const;
+    QVector<int> search(const QVector<int>& goals) const;
+
+    // Lowers distances outward from the given tile, for when a wall is removed
+    void relax(QVector<int>* field, int index) const;
+
+};
+
+} // namespace mms
@@ -10,6 +10,7 @@ const QMap<MazeFileType, QString>& MAZE_FILE_TYPE_TO_STRING() {
         {MazeFileType::MAZ, "MAZ"},
         {MazeFileType::MZ2, "MZ2"},
         {MazeFileType::NUM, "NUM"},
+        {MazeFileType::MZC, "MZC"},
     };
     return map;
 }
@@ -26,6 +27,7 @@ const QMap<MazeFileType, QString>& MAZE_FILE_TYPE_TO_SUFFIX() {
         {MazeFileType::MAZ, "MAZ"},
         {MazeFileType::MZ2, "MZ2"},
         {MazeFileType::NUM, "num"},
+        {MazeFileType::MZC, "mzc"},
     };
     return map;
 }
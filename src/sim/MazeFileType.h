@@ -13,6 +13,7 @@ enum class MazeFileType {
     MAZ,
     MZ2,
     NUM,
+    MZC,
 };
 
 const QMap<MazeFileType, QString>& MAZE_FILE_TYPE_TO_STRING();
@@ -2,85 +2,255 @@
 
 #include <QChar>
 #include <QFile>
+#include <QFileInfo>
 #include <QString>
+#include <QtEndian>
+
+#include <climits>
 
 #include "Logging.h"
+#include "MazeCorpus.h"
 #include "MazeChecker.h"
-#include "SimUtilities.h"
 
 namespace mms {
 
 BasicMaze MazeFileUtilities::load(const QString& path) {
+
+    // Single mazes within a corpus file are addressed by index
+    QString corpusPath;
+    int corpusIndex = 0;
+    if (
+        !QFile::exists(path) &&
+        MazeCorpus::parseEntryPath(path, &corpusPath, &corpusIndex)
+    ) {
+        return MazeCorpus(corpusPath).getMaze(corpusIndex);
+    }
+
     QFile file(path);
     // TODO: MACK - replace with QFile::exists
     if (!file.open(QIODevice::ReadOnly)) {
         throw std::runtime_error("file doesn't exist");
     }
-    return loadBytes(file.readAll());
+
+    // Parse straight out of the memory mapped file if possible, rather
+    // than copying its contents; QFile unmaps it when it's destroyed
+    qint64 size = file.size();
+    uchar* data = (0 < size ? file.map(0, size) : nullptr);
+    if (data == nullptr) {
+        return loadBytes(file.readAll());
+    }
+    return loadBytes(QByteArray::fromRawData(
+        reinterpret_cast<const char*>(data),
+        static_cast<int>(size)));
 }
 
 BasicMaze MazeFileUtilities::loadBytes(const QByteArray& bytes) {
 
-    // Since we don't know anything about the file type ahead of time, we
-    // simply brute force try each of the file types until either one succeeds
-    // or they all fail
-
-    #define TRY(expression, validate)\
-    try {\
-        BasicMaze maze = expression;\
-        MazeValidity validity = MazeChecker::checkMaze(maze);\
-        if (validity != MazeValidity::INVALID) {\
-            if (\
-                !validate ||\
-                validity == MazeValidity::EXPLORABLE ||\
-                validity == MazeValidity::OFFICIAL\
-            ) {\
-                return maze;\
-            }\
-        }\
-    }\
-    catch (...) { }
-
-    TRY(deserializeMazType(bytes), true);
-    TRY(deserializeMz2Type(bytes), true);
-    TRY(deserializeNumType(bytes), true);
-    TRY(deserializeMapType(bytes), false);
+    // We try the most likely file type first, and then fall back to the
+    // remaining file types until either one succeeds or they all fail
+    for (MazeFileType type : getCandidateTypes(bytes)) {
+        try {
+            BasicMaze maze = deserialize(bytes, type);
+            MazeValidity validity = MazeChecker::checkMaze(maze);
+            if (validity == MazeValidity::INVALID) {
+                continue;
+            }
+            // The map format is lenient enough to accept almost anything,
+            // so any maze that can be drawn is good enough
+            if (
+                type == MazeFileType::MAP ||
+                validity == MazeValidity::EXPLORABLE ||
+                validity == MazeValidity::OFFICIAL
+            ) {
+                return maze;
+            }
+        }
+        catch (...) { }
+    }
     throw std::runtime_error("invalid format");
 }
 
+MazeFileType MazeFileUtilities::sniffType(const QByteArray& bytes) {
+
+    // Corpus files are the only format with a magic number
+    if (MazeCorpus::isCorpus(bytes)) {
+        return MazeFileType::MZC;
+    }
+
+    // Binary files contain control characters other than whitespace; the
+    // .MAZ format is always exactly 16x16 bytes, each of which is a nibble
+    bool binary = false;
+    bool nibbles = true;
+    for (int i = 0; i < bytes.size(); i += 1) {
+        unsigned char c = static_cast<unsigned char>(bytes.at(i));
+        if ((c < 0x20 && c != '\t' && c != '\n' && c != '\r') || 0x7f <= c) {
+            binary = true;
+        }
+        if (16 <= c) {
+            nibbles = false;
+        }
+    }
+    if (binary) {
+        return (bytes.size() == 256 && nibbles) ? MazeFileType::MAZ : MazeFileType::MZ2;
+    }
+
+    // Text files: .num lines start with the x coordinate, whereas .map
+    // files start with a maze post character
+    for (int i = 0; i < bytes.size(); i += 1) {
+        char c = bytes.at(i);
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+            continue;
+        }
+        return ('0' <= c && c <= '9') ? MazeFileType::NUM : MazeFileType::MAP;
+    }
+    return MazeFileType::MAP;
+}
+
+QVector<MazeFileType> MazeFileUtilities::getCandidateTypes(const QByteArray& bytes) {
+    QVector<MazeFileType> types {
+        MazeFileType::MAZ,
+        MazeFileType::MZ2,
+        MazeFileType::NUM,
+        MazeFileType::MAP,
+        MazeFileType::MZC,
+    };
+    MazeFileType likely = sniffType(bytes);
+    types.removeOne(likely);
+    types.prepend(likely);
+    return types;
+}
+
+BasicMaze MazeFileUtilities::deserialize(const QByteArray& bytes, MazeFileType type) {
+    switch (type) {
+        case MazeFileType::MAP:
+            return deserializeMapType(bytes);
+        case MazeFileType::MAZ:
+            return deserializeMazType(bytes);
+        case MazeFileType::MZ2:
+            return deserializeMz2Type(bytes);
+        case MazeFileType::NUM:
+            return deserializeNumType(bytes);
+        case MazeFileType::MZC:
+            // Loading a whole corpus as one maze yields its first maze
+            return MazeCorpus(bytes).getMaze(0);
+    }
+    throw std::runtime_error("unknown format");
+}
+
+QVector<QByteArray> MazeFileUtilities::splitLines(const QByteArray& bytes) {
+
+    // Trim surrounding whitespace, like QString::trimmed
+    int begin = 0;
+    int end = bytes.size();
+    auto isSpace = [](char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+    };
+    while (begin < end && isSpace(bytes.at(begin))) {
+        begin += 1;
+    }
+    while (begin < end && isSpace(bytes.at(end - 1))) {
+        end -= 1;
+    }
+
+    // Split on "\n", "\r\n" or "\r"; each line refers to the original data
+    QVector<QByteArray> lines;
+    const char* data = bytes.constData();
+    int start = begin;
+    for (int i = begin; i < end; i += 1) {
+        if (data[i] == '\n' || data[i] == '\r') {
+            lines.append(QByteArray::fromRawData(data + start, i - start));
+            if (data[i] == '\r' && i + 1 < end && data[i + 1] == '\n') {
+                i += 1;
+            }
+            start = i + 1;
+        }
+    }
+    if (begin < end) {
+        lines.append(QByteArray::fromRawData(data + start, end - start));
+    }
+    return lines;
+}
+
 void MazeFileUtilities::save(
     const BasicMaze& maze,
     const QString& path,
     MazeFileType type) {
+    QByteArray bytes;
+    serialize(maze, type, &bytes);
+    writeFile(path, bytes);
+}
 
-    // TODO: MACK - should throw exception
+void MazeFileUtilities::saveBatch(
+    const QVector<BasicMaze>& mazes,
+    const QString& path,
+    MazeFileType type) {
+
+    // Corpus files hold all of the mazes, so we only write a single file
+    if (type == MazeFileType::MZC) {
+        writeFile(path, MazeCorpus::serialize(mazes, true));
+        return;
+    }
+
+    // Otherwise, each maze gets its own numbered file, "<base>_<i>.<suffix>",
+    // and every maze is serialized into the same reusable buffer
+    QFileInfo info(path);
+    QString base = info.path() + "/" + info.completeBaseName() + "_";
+    QString suffix = "." + MAZE_FILE_TYPE_TO_SUFFIX().value(type);
+    int fieldWidth = QString::number(mazes.size() - 1).size();
+    QByteArray bytes;
+    for (int i = 0; i < mazes.size(); i += 1) {
+        serialize(mazes.at(i), type, &bytes);
+        writeFile(base + QString("%1").arg(i, fieldWidth, 10, QChar('0')) + suffix, bytes);
+    }
+}
+
+QByteArray MazeFileUtilities::serialize(const BasicMaze& maze, MazeFileType type) {
     QByteArray bytes;
+    serialize(maze, type, &bytes);
+    return bytes;
+}
+
+void MazeFileUtilities::serialize(const BasicMaze& maze, MazeFileType type, QByteArray* bytes) {
     switch (type) {
         case MazeFileType::MAP:
-            bytes = serializeMapType(maze);
+            serializeMapType(maze, bytes);
+            return;
         case MazeFileType::MAZ:
-            bytes = serializeMazType(maze);
+            serializeMazType(maze, bytes);
+            return;
         case MazeFileType::MZ2:
-            bytes = serializeMz2Type(maze);
+            serializeMz2Type(maze, bytes);
+            return;
         case MazeFileType::NUM:
-            bytes = serializeNumType(maze);
-        default:
-            // TODO: MACK
-            SimUtilities::quit();
+            serializeNumType(maze, bytes);
+            return;
+        case MazeFileType::MZC:
+            *bytes = MazeCorpus::serialize({maze}, true);
+            return;
+    }
+    throw std::runtime_error("unknown format");
+}
+
+void MazeFileUtilities::writeFile(const QString& path, const QByteArray& bytes) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        throw std::runtime_error("unable to open file for writing");
+    }
+    if (file.write(bytes) != bytes.size()) {
+        throw std::runtime_error("unable to write file");
     }
-    // TODO: MACK - write to file
 }
 
 BasicMaze MazeFileUtilities::deserializeMapType(const QByteArray& bytes) {
 
-    // First, convert the bytes to lines
-    QStringList lines = SimUtilities::splitLines(QString(bytes).trimmed());
+    // First, split the bytes into lines, without copying them
+    QVector<QByteArray> lines = splitLines(bytes);
 
-    // The maze to be returned
-    BasicMaze upsideDownMaze;
+    // The walls of each tile, column by column
+    QVector<QVector<unsigned char>> upsideDownMaze;
 
     // The character representing a maze post
-    QChar delimiter('\0');
+    char delimiter('\0');
 
     // The number of horizontal spaces between columns
     QVector<int> spaces;
@@ -90,20 +260,26 @@ BasicMaze MazeFileUtilities::deserializeMapType(const QByteArray& bytes) {
 
     // Iterate over all of the lines
     for (int i = 0; i < lines.size(); i += 1) {
-        QString line = lines.at(i);
+        const QByteArray& line = lines.at(i);
+        if (line.size() == 0) {
+            throw std::runtime_error("Empty line");
+        }
 
         // Special case for the first line of the file
         if (i == 0) {
-            if (line.size() == 0) {
-                // TODO: MACK - clean this up
-                throw std::runtime_error("Invalid first line");
-            }
             delimiter = line.at(0);
-            QStringList tokens = line.split(delimiter, QString::SkipEmptyParts);
-            for (int j = 0; j < tokens.size(); j += 1) {
-                QVector<BasicTile> column;
-                upsideDownMaze.push_back(column);
-                spaces.push_back(tokens.at(j).size());
+            // Each run of non-delimiter characters is a column
+            int run = 0;
+            for (int j = 0; j <= line.size(); j += 1) {
+                if (j < line.size() && line.at(j) != delimiter) {
+                    run += 1;
+                    continue;
+                }
+                if (0 < run) {
+                    upsideDownMaze.push_back(QVector<unsigned char>());
+                    spaces.push_back(run);
+                }
+                run = 0;
             }
         }
 
@@ -115,16 +291,12 @@ BasicMaze MazeFileUtilities::deserializeMapType(const QByteArray& bytes) {
                 if (line.size() <= position) {
                     break;
                 }
-                BasicTile tile;
-                for (Direction direction : DIRECTIONS()) {
-                    tile.insert(direction, false);
-                }
-                upsideDownMaze[j].push_back(tile);
+                upsideDownMaze[j].push_back(0);
                 if (0 < spaces.at(j)) {
                     bool isWall = line.at(position) != ' ';
-                    upsideDownMaze[j][rowsFromTopOfMaze][Direction::NORTH] = isWall;
+                    setTileWall(&upsideDownMaze[j][rowsFromTopOfMaze], Direction::NORTH, isWall);
                     if (0 < rowsFromTopOfMaze) {
-                        upsideDownMaze[j][rowsFromTopOfMaze - 1][Direction::SOUTH] = isWall;
+                        setTileWall(&upsideDownMaze[j][rowsFromTopOfMaze - 1], Direction::SOUTH, isWall);
                     }
                 }
                 if (j < spaces.size() - 1) {
@@ -143,10 +315,10 @@ BasicMaze MazeFileUtilities::deserializeMapType(const QByteArray& bytes) {
                 }
                 bool isWall = line.at(position) != ' ';
                 if (0 < j) {
-                    upsideDownMaze[j - 1][rowsFromTopOfMaze][Direction::EAST] = isWall;
+                    setTileWall(&upsideDownMaze[j - 1][rowsFromTopOfMaze], Direction::EAST, isWall);
                 }
                 if (j < spaces.size()) {
-                    upsideDownMaze[j][rowsFromTopOfMaze][Direction::WEST] = isWall;
+                    setTileWall(&upsideDownMaze[j][rowsFromTopOfMaze], Direction::WEST, isWall);
                     position += spaces.at(j) + 1;
                 }
             }
@@ -159,80 +331,70 @@ BasicMaze MazeFileUtilities::deserializeMapType(const QByteArray& bytes) {
     }
 
     // Flip the maze so that it's right side up
-    BasicMaze rightSideUpMaze;
+    QVector<QVector<unsigned char>> rightSideUpMaze;
     for (int i = 0; i < upsideDownMaze.size(); i += 1) {
-        QVector<BasicTile> column;
+        QVector<unsigned char> column;
         for (int j = upsideDownMaze.at(i).size() - 1; j >= 0; j -= 1) {
             column.push_back(upsideDownMaze.at(i).at(j));
         }
         rightSideUpMaze.push_back(column);
     }
 
-    return rightSideUpMaze;
+    return fromColumns(rightSideUpMaze);
 }
 
 BasicMaze MazeFileUtilities::deserializeMazType(const QByteArray& bytes) {
 
-    // TODO: MACK - QVector aborts the application without this
-    throw std::runtime_error("MACK");
-
-    // TODO: MACK Convert this to use Qt
-    QVector<char> characters;
-    for (int i = 0; i < bytes.size(); i += 1) {
-        characters.push_back(bytes.at(i));
+    // This maze file format is written to only accomodate 16x16 mazes, so we
+    // check the size up front rather than reading past the end of the bytes
+    if (bytes.size() != 16 * 16) {
+        throw std::runtime_error("MAZ files must contain exactly 256 bytes");
     }
-    
-    // The maze to be returned
-    BasicMaze maze;
 
-    // This maze file format is written to only accomodate 16x16 mazes
-    // We can hardcode this becuase all the load functions run in try blocks
+    // The walls of each tile, column by column
+    QVector<QVector<unsigned char>> maze;
     for (int x = 0; x < 16; x += 1) {
-        QVector<BasicTile> column;
+        QVector<unsigned char> column;
         for (int y = 0; y < 16; y += 1) {
-            int walls = characters.at(x * 16 + y);
-            BasicTile tile;
+            int walls = static_cast<unsigned char>(bytes.at(x * 16 + y));
+            unsigned char tile = 0;
             //Each byte reprsents the walls like this: 'X X X X W S E N'
-            tile[Direction::WEST]  = (walls & 1 << 3) != 0;
-            tile[Direction::SOUTH] = (walls & 1 << 2) != 0;
-            tile[Direction::EAST]  = (walls & 1 << 1) != 0;
-            tile[Direction::NORTH] = (walls & 1 << 0) != 0;
+            setTileWall(&tile, Direction::WEST,  (walls & 1 << 3) != 0);
+            setTileWall(&tile, Direction::SOUTH, (walls & 1 << 2) != 0);
+            setTileWall(&tile, Direction::EAST,  (walls & 1 << 1) != 0);
+            setTileWall(&tile, Direction::NORTH, (walls & 1 << 0) != 0);
             column.push_back(tile);
         }
         maze.push_back(column);
     }
 
-    return maze;
+    return fromColumns(maze);
 }
 
 BasicMaze MazeFileUtilities::deserializeMz2Type(const QByteArray& bytes) {
 
-    // TODO: Convert this to use Qt
-    QVector<char> characters;
-    for (int i = 0; i < bytes.size(); i += 1) {
-        characters.push_back(bytes.at(i));
-    }
-
-    // Reverse the vector order so we can pop back for the next character
-    std::reverse(characters.begin(), characters.end());
-
-    // Why oh why can't cant iterators throw exceptions when derefrencing to invalid locations
-    // Pop back and get popped element
-    auto getPopBack = [](QVector<char>* v) {if(v->size()==0){throw std::exception();}
-                                                      auto e = v->back();
-                                                      v->pop_back();
-                                                      return e;};
+    // Read the bytes in order, without copying them
+    int cursor = 0;
+    auto getNext = [&bytes, &cursor]() {
+        if (bytes.size() <= cursor) {
+            throw std::exception();
+        }
+        unsigned char e = bytes.at(cursor);
+        cursor += 1;
+        return e;
+    };
 
-    uint32_t stringLength = (getPopBack(&characters) << 4) +
-                             getPopBack(&characters);
+    // Read each byte in its own statement, since the order in which the
+    // operands of an expression are evaluated is unspecified
+    uint32_t stringLength = getNext() << 4;
+    stringLength += getNext();
 
-    QString mazeName; // The title is not used, but here if needed
-                          // It is a UTF-8 formatted sring
+    // The title is a UTF-8 formatted string; it is not used, so we simply
+    // skip over it rather than copying it out
 
     if (stringLength != 0) {
         while (stringLength != 0) {
-            unsigned char character = getPopBack(&characters);
-            mazeName += character;
+            unsigned char character = getNext();
             if (character >> 7 == 0 ||
                 character >> 6 == 3) { // 11 in binary
                 // This is a utf-8 formated string.  Only decrement the counter
@@ -242,53 +404,49 @@ BasicMaze MazeFileUtilities::deserializeMz2Type(const QByteArray& bytes) {
         }
     }
 
-    uint32_t width = (getPopBack(&characters) << 24) +
-                     (getPopBack(&characters) << 16) +
-                     (getPopBack(&characters) << 8) +
-                     (getPopBack(&characters));
+    uint32_t width = 0;
+    for (int i = 0; i < 4; i += 1) {
+        width = (width << 8) | getNext();
+    }
 
-    uint32_t height = (getPopBack(&characters) << 24) +
-                      (getPopBack(&characters) << 16) +
-                      (getPopBack(&characters) << 8) +
-                      (getPopBack(&characters));
+    uint32_t height = 0;
+    for (int i = 0; i < 4; i += 1) {
+        height = (height << 8) | getNext();
+    }
     
     // Let's make sure we do not read a massive size and go on forerver
     if (width > 256 || height > 256) {
         throw std::exception();
     }
 
-    BasicMaze maze;
+    BasicMaze maze(width, height);
 
     for (auto x = 0; x < width; x++) {
-        QVector<BasicTile> column;
         for (auto y = 0; y < height; y++) {
-            BasicTile tile;
             for (Direction direction : DIRECTIONS()) {
                 // Make a filled maze so we get the maze border for free
                 // and don't need any special logic to make it happen
-                tile.insert(direction, true);
+                maze.setWall(x, y, direction, true);
             }
-            column.push_back(tile);
         }
-        maze.push_back(column);
     }
 
     int numberOfBits = 0;
     int numberOfBytes = 0;
-    unsigned char byte = getPopBack(&characters);
+    unsigned char byte = getNext();
 
     for (auto y = 0; y < height - 1; y++) {
         for (auto x = 0; x < width; x++) {
             bool wallExists = (byte & 1) == 1;
             byte >>= 1;
 
-            maze[x][height - 1 - y][Direction::SOUTH] = wallExists;
-            maze[x][height - 1 - y - 1][Direction::NORTH] = wallExists;
+            // Also sets the north wall of the tile below
+            maze.setWall(x, height - 1 - y, Direction::SOUTH, wallExists);
 
             numberOfBits = (numberOfBits + 1) % 8;
 
             if (numberOfBits == 0) {
-                byte = getPopBack(&characters);
+                byte = getNext();
                 numberOfBytes = (numberOfBytes + 1) % 8; // Add one to the number of bytes
             }
         }
@@ -296,26 +454,26 @@ BasicMaze MazeFileUtilities::deserializeMz2Type(const QByteArray& bytes) {
 
     if (numberOfBytes != 0) {
         for (auto i = 0; i < (7 - numberOfBytes); i += 1) {
-            getPopBack(&characters); // Padding so the number of bytes is a muliple of 8
+            getNext(); // Padding so the number of bytes is a muliple of 8
         }
         numberOfBytes = 0;
     }
     numberOfBits = 0;
 
-    byte = getPopBack(&characters);
+    byte = getNext();
 
     for (auto x = 0; x < width - 1; x++) {
         for (auto y = 0; y < height; y++) {
             bool wallExists = (byte & 1) == 1;
             byte >>= 1;
 
-            maze[x][height - 1 - y][Direction::EAST] = wallExists;
-            maze[x + 1][height - 1 - y][Direction::WEST] = wallExists;
+            // Also sets the west wall of the tile to the right
+            maze.setWall(x, height - 1 - y, Direction::EAST, wallExists);
             
             numberOfBits = (numberOfBits + 1) % 8;
 
             if (numberOfBits == 0) {
-                byte = getPopBack(&characters);
+                byte = getNext();
                 numberOfBytes = (numberOfBytes + 1) % 8; // Add one to the number of bytes
             }
         }
@@ -326,40 +484,90 @@ BasicMaze MazeFileUtilities::deserializeMz2Type(const QByteArray& bytes) {
 
 BasicMaze MazeFileUtilities::deserializeNumType(const QByteArray& bytes) {
 
-    // The maze to be returned
-    BasicMaze maze;
+    // The walls of each tile, column by column
+    QVector<QVector<unsigned char>> maze;
 
     // The column to be appended
-    QVector<BasicTile> column;
-
-    // Iterate over all of the lines
-    QStringList lines = SimUtilities::splitLines(QString(bytes).trimmed());
-    for (QString line : lines) {
+    QVector<unsigned char> column;
+
+    // Whether a blank line came after the first tile
+    bool sawBlankLine = false;
+
+    // Scan the bytes directly; each line is "x y n e s w"
+    const char* p = bytes.constData();
+    const char* end = p + bytes.size();
+    while (p < end) {
+
+        // Parse the integer tokens of the line
+        int tokens[6];
+        int numTokens = 0;
+        while (p < end && *p != '\n' && *p != '\r') {
+            if (*p == ' ' || *p == '\t') {
+                p += 1;
+                continue;
+            }
+            bool negative = (*p == '-');
+            if (negative) {
+                p += 1;
+            }
+            if (p == end || *p < '0' || '9' < *p) {
+                throw std::runtime_error("Non-numeric token");
+            }
+            // Accumulate in 64 bits, stopping as soon as the value no
+            // longer fits in an int, so that long tokens can't overflow
+            qint64 value = 0;
+            while (p < end && '0' <= *p && *p <= '9') {
+                value = 10 * value + (*p - '0');
+                if (INT_MAX < value) {
+                    throw std::runtime_error("Numeric token out of range");
+                }
+                p += 1;
+            }
+            if (p < end && *p != ' ' && *p != '\t' && *p != '\n' && *p != '\r') {
+                throw std::runtime_error("Non-numeric token");
+            }
+            if (numTokens < 6) {
+                tokens[numTokens] = static_cast<int>(negative ? -value : value);
+            }
+            numTokens += 1;
+        }
 
-        // Put the tokens in a vector
-        QStringList tokens = line.split(" ", QString::SkipEmptyParts);
-        if (tokens.size() < 6) {
-            throw std::runtime_error("Not enough tokens");
+        // Consume exactly one line terminator, "\n", "\r\n", or "\r"
+        if (p < end && *p == '\r') {
+            p += 1;
+            if (p < end && *p == '\n') {
+                p += 1;
+            }
         }
-        for (const QString& token : tokens) {
-            if (!SimUtilities::isInt(token)) {
-                throw std::runtime_error("Non-numeric token");
+        else if (p < end && *p == '\n') {
+            p += 1;
+        }
+
+        // As before, blank lines are only allowed at the start and the end
+        // of the file, where they used to be trimmed
+        if (numTokens == 0) {
+            if (!maze.isEmpty() || !column.isEmpty()) {
+                sawBlankLine = true;
             }
+            continue;
+        }
+        if (numTokens < 6 || sawBlankLine) {
+            throw std::runtime_error("Not enough tokens");
         }
 
-        // Fill the BasicTile object with the values
-        BasicTile tile;
+        // Fill the tile walls with the values
+        unsigned char tile = 0;
         for (Direction direction : DIRECTIONS()) {
-            QString num = tokens.at(2 + DIRECTIONS().indexOf(direction));
-            tile.insert(
+            setTileWall(
+                &tile,
                 direction,
-                SimUtilities::strToInt(num) == 1
+                tokens[2 + DIRECTIONS().indexOf(direction)] == 1
             );
         }
 
         // If the tile belongs to a new column,
         // append the current column and empty it
-        if (maze.size() < SimUtilities::strToInt(tokens.at(0))) {
+        if (maze.size() < tokens[0]) {
             maze.push_back(column);
             column.clear();
         }
@@ -368,281 +576,208 @@ BasicMaze MazeFileUtilities::deserializeNumType(const QByteArray& bytes) {
         column.push_back(tile);
     }
 
+    // As before, a file without any tiles doesn't have enough tokens
+    if (maze.isEmpty() && column.isEmpty()) {
+        throw std::runtime_error("Not enough tokens");
+    }
+
     // Make sure to append the last column
     maze.push_back(column);
 
-    return maze;
+    return fromColumns(maze);
 }
 
-QByteArray MazeFileUtilities::serializeMapType(const BasicMaze& maze) {
+void MazeFileUtilities::serializeMapType(const BasicMaze& maze, QByteArray* bytes) {
 
-    // TODO: MACK - FIXME
-    // TODO: MACK - deduplicate this with the maze algo code
-    /*
     // The characters to use in the file
     char post = '+';
     char space = ' ';
     char vertical = '|';
     char horizontal = '-';
 
-    // A blank line, and a list of all lines to be written
-    QString blankLine(4 * maze.size() + 1, space);
-    QVector<QString> upsideDownLines {blankLine};
-
-    // For all tiles in the maze
-    for (int i = 0; i < maze.size(); i += 1) {
-        for (int j = 0; j < maze.at(i).size(); j += 1) {
-
-            // Insert more lines if necessary
-            if (upsideDownLines.size() <= 2 * j + 1) {
-                upsideDownLines.push_back(blankLine);
-                upsideDownLines.push_back(blankLine);
+    // Each tile is four characters wide and two lines tall, plus one extra
+    // column and line for the posts on the right and top of the maze, so we
+    // know the exact size of the output up front
+    int width = maze.getWidth();
+    int height = maze.getHeight();
+    int lineLength = 4 * width + 1 + 1; // Including the newline
+    int numLines = 2 * height + 1;
+    bytes->fill(space, lineLength * numLines);
+    char* data = bytes->data();
+
+    // Lines are written top to bottom, and line 2 * (height - y) contains the
+    // north walls of row y, while the line below it contains its side walls
+    for (int line = 0; line < numLines; line += 1) {
+        char* chars = data + line * lineLength;
+        chars[lineLength - 1] = '\n';
+        int y = height - 1 - line / 2;
+        if (line % 2 == 0) {
+            for (int x = 0; x <= width; x += 1) {
+                chars[4 * x] = post;
             }
-
-            // Insert posts at the boundaries
-            int left = 4 * i;
-            int right = 4 * (i + 1);
-            int up = 2 * (j + 1);
-            int down = 2 * j;
-            upsideDownLines.at(down).at(left) = post;
-            upsideDownLines.at(down).at(right) = post;
-            upsideDownLines.at(up).at(left) = post;
-            upsideDownLines.at(up).at(right) = post;
-
-            // Insert walls if they exist
-            if (maze.at(i).at(j).at(Direction::NORTH)) {
-                for (int k = 0; k < 3; k += 1) {
-                    upsideDownLines.at(up).at(left + 1 + k) = horizontal;
+            for (int x = 0; x < width; x += 1) {
+                bool isWall = (
+                    line == numLines - 1
+                    ? maze.isWall(x, 0, Direction::SOUTH)
+                    : maze.isWall(x, y, Direction::NORTH)
+                );
+                if (isWall) {
+                    for (int k = 0; k < 3; k += 1) {
+                        chars[4 * x + 1 + k] = horizontal;
+                    }
                 }
             }
-            if (maze.at(i).at(j).at(Direction::SOUTH)) {
-                for (int k = 0; k < 3; k += 1) {
-                    upsideDownLines.at(down).at(left + 1 + k) = horizontal;
+        }
+        else {
+            for (int x = 0; x < width; x += 1) {
+                if (maze.isWall(x, y, Direction::WEST)) {
+                    chars[4 * x] = vertical;
                 }
             }
-            if (maze.at(i).at(j).at(Direction::EAST)) {
-                upsideDownLines.at(down + 1).at(right) = vertical;
-            }
-            if (maze.at(i).at(j).at(Direction::WEST)) {
-                upsideDownLines.at(down + 1).at(left) = vertical;
+            if (0 < width && maze.isWall(width - 1, y, Direction::EAST)) {
+                chars[4 * width] = vertical;
             }
         }
     }
-
-    // Flip the lines so that they're right side up
-    QVector<QString> rightSideUpLines;
-    for (int i = upsideDownLines.size() - 1; i >= 0; i -= 1) {
-        rightSideUpLines.push_back(upsideDownLines.at(i));
-    }
-
-    // Create the stream
-    std::ofstream file(mazeFilePath.toStdString(), std::ios::trunc);
-
-    // Make sure the file is open
-    if (!file.is_open()) {
-        return false;
-    }
-
-    // Write to the file
-    for (QString line : rightSideUpLines) {
-        file << line << '\n'; // std::endl flushes the buffer everytime its called
-    }
-
-    // Make sure to close the file
-    file.close();
-
-    // Return success
-    return true;
-    */
-    throw std::exception();
 }
 
-QByteArray MazeFileUtilities::serializeMazType(const BasicMaze& maze) {
-
-    // TODO: MACK - FIXME
-    /*
-    if (maze.size() != 16) {
-        return false; // We only support 16x16 mazes
-    }
-
-    if (maze.at(0).size() != 16) {
-        // Lets assume the maze is at least rectangular. I don't know if it cannot be
-
-        return false; // We only support 16x16 mazes
-    }
-
-    // Create the stream
-    std::ofstream file(mazeFilePath.toStdString(), std::ios::trunc | std::ios::binary);
-    file.imbue(std::locale::classic());
+void MazeFileUtilities::serializeMazType(const BasicMaze& maze, QByteArray* bytes) {
 
-    // Make sure the file is open
-    if (!file.is_open()) {
-        return false;
+    // This maze file format is written to only accomodate 16x16 mazes
+    if (maze.getWidth() != 16 || maze.getHeight() != 16) {
+        throw std::runtime_error("MAZ files only support 16x16 mazes");
     }
 
-    // We hardcode values becuase we specifically checked that the maze
-    // was 16x16 above.
-    for (auto x = 0; x < 16; x++) {
-        for (auto y = 0; y < 16; y++) {
-            BasicTile tile = maze.at(x).at(y);
+    bytes->resize(16 * 16);
+    char* data = bytes->data();
+    for (int x = 0; x < 16; x += 1) {
+        for (int y = 0; y < 16; y += 1) {
             //Each byte reprsents the walls like this: 'X X X X W S E N'
-            int representation = (tile[Direction::WEST]  << 3) +
-                                 (tile[Direction::SOUTH] << 2) +
-                                 (tile[Direction::EAST]  << 1) +
-                                 (tile[Direction::NORTH] << 0);
-
-            file.put(representation);
+            data[x * 16 + y] = static_cast<char>(
+                (maze.isWall(x, y, Direction::WEST)  << 3) |
+                (maze.isWall(x, y, Direction::SOUTH) << 2) |
+                (maze.isWall(x, y, Direction::EAST)  << 1) |
+                (maze.isWall(x, y, Direction::NORTH) << 0)
+            );
         }
     }
-
-    // Make sure to close the file
-    file.close();
-
-    // Return success
-    return true;
-    */
-    throw std::exception();
 }
 
-QByteArray MazeFileUtilities::serializeMz2Type(const BasicMaze& maze) {
-
-    // TODO: MACK - FIXME
-    /*
-    // Create the stream
-    std::ofstream file(mazeFilePath.toStdString(), std::ios::trunc | std::ios::binary);
-    file.imbue(std::locale::classic());
-
-    // Make sure the file is open
-    if (!file.is_open()) {
-        return false;
-    }
-
-    file.put(0);  // Hardcoded name is: 'Auto Generated Maze' (length: 19)
-    file.put(19); // I am assuming that the length is encoded in 16 bits.
-                  // The spec is unclear
-    
-    file << "Auto Generated Maze";
-
-    uint32_t width = maze.size();
-    uint32_t height = 0;
-
-    if (maze.size() > 0) {
-        height = maze.at(0).size();
-        if (height == 0)
-            return false; // I don't think this should be allowed?
-    }
-    else
-        return false; // I don't think this should be allowed?
-
-    file.put(width >> 24); // width
-    file.put(width >> 16);
-    file.put(width >> 8);
-    file.put(width);
-
-    file.put(height >> 24); // height
-    file.put(height >> 16);
-    file.put(height >> 8);
-    file.put(height);
-
-    int numberOfBits = 0;
-    int numberOfBytes = 0;
-    unsigned char toWrite = 0;
-
-    for (auto y = 0; y < height - 1; y++) {
-        for (auto x = 0; x < width; x++) {
-            BasicTile tile = maze.at(x).at(height - 1 - y);
-
-            toWrite >>= 1;
-            if (tile[Direction::SOUTH] == true) {
-                toWrite |= 1 << 7; // Set the MSB bit as one
-            }
-            numberOfBits = (numberOfBits + 1) % 8;
-
-            if (numberOfBits == 0) {
-                file.put(toWrite); // Write the byte when it is full
-                numberOfBytes = (numberOfBytes + 1) % 8; // Add one to the number of bytes
+void MazeFileUtilities::serializeMz2Type(const BasicMaze& maze, QByteArray* bytes) {
+
+    // The reader only accepts mazes up to 256x256, with at least one tile
+    int width = maze.getWidth();
+    int height = maze.getHeight();
+    if (width == 0 || height == 0 || width > 256 || height > 256) {
+        throw std::runtime_error("MZ2 files only support mazes up to 256x256");
+    }
+
+    // Each section of walls is packed LSB first. The reader always fetches
+    // one byte beyond the last full byte of a section, and then skips ahead
+    // to a multiple of eight bytes, so we size the sections to match.
+    int southBits = width * (height - 1);
+    int southBytes = 1 + southBits / 8;
+    if ((southBits / 8) % 8 != 0) {
+        southBytes += 7 - (southBits / 8) % 8;
+    }
+    int eastBits = (width - 1) * height;
+    int eastBytes = 1 + eastBits / 8;
+
+    // An empty title, followed by the big-endian width and height
+    int headerSize = 2 + 4 + 4;
+    bytes->fill('\0', headerSize + southBytes + eastBytes);
+    uchar* data = reinterpret_cast<uchar*>(bytes->data());
+    qToBigEndian<quint32>(width, data + 2);
+    qToBigEndian<quint32>(height, data + 6);
+
+    // The south walls, from the top row down, excluding the bottom row
+    uchar* south = data + headerSize;
+    int bit = 0;
+    for (int y = 0; y < height - 1; y += 1) {
+        for (int x = 0; x < width; x += 1) {
+            if (maze.isWall(x, height - 1 - y, Direction::SOUTH)) {
+                south[bit / 8] |= 1 << (bit % 8);
             }
+            bit += 1;
         }
     }
 
-    if (numberOfBits != 0) {
-        file.put(toWrite >> (8 - numberOfBits));
-        numberOfBits = 0; // Write the last byte out 
-    }
-    
-    if (numberOfBytes != 0) {
-        for (auto i = 0; i < (7 - numberOfBytes); i += 1 {
-            file.put(0); // Padding so the number of bytes is a muliple of 8
+    // The east walls, column by column, excluding the rightmost column
+    uchar* east = south + southBytes;
+    bit = 0;
+    for (int x = 0; x < width - 1; x += 1) {
+        for (int y = 0; y < height; y += 1) {
+            if (maze.isWall(x, height - 1 - y, Direction::EAST)) {
+                east[bit / 8] |= 1 << (bit % 8);
+            }
+            bit += 1;
         }
-        numberOfBytes = 0;
     }
+}
 
-    for (auto x = 0; x < width - 1; x++) {
-        for (auto y = 0; y < height; y++) {
-            BasicTile tile = maze.at(x).at(height - 1 - y);
-
-            toWrite >>= 1;
-            if (tile[Direction::EAST] == true) {
-                toWrite |= 1 << 7; // Set the MSB bit as one
-            }
-            numberOfBits = (numberOfBits + 1) % 8;
-
-            if (numberOfBits == 0) {
-                file.put(toWrite); // Write the byte when it is full
-                numberOfBytes = (numberOfBytes + 1) % 8; // Add one to the number of bytes
+void MazeFileUtilities::serializeNumType(const BasicMaze& maze, QByteArray* bytes) {
+
+    // Each line is "x y n e s w", and the dimensions of a maze are stored in
+    // sixteen bits or less, so each coordinate has at most five digits
+    int numTiles = maze.getWidth() * maze.getHeight();
+    bytes->resize(numTiles * (5 + 1 + 5 + 4 * 2 + 1));
+    char* data = bytes->data();
+    int size = 0;
+    auto appendInt = [data, &size](int value) {
+        char digits[10];
+        int numDigits = 0;
+        do {
+            digits[numDigits] = '0' + value % 10;
+            numDigits += 1;
+            value /= 10;
+        } while (0 < value);
+        while (0 < numDigits) {
+            numDigits -= 1;
+            data[size] = digits[numDigits];
+            size += 1;
+        }
+    };
+    for (int x = 0; x < maze.getWidth(); x += 1) {
+        for (int y = 0; y < maze.getHeight(); y += 1) {
+            appendInt(x);
+            data[size] = ' ';
+            size += 1;
+            appendInt(y);
+            for (Direction direction : DIRECTIONS()) {
+                data[size] = ' ';
+                data[size + 1] = maze.isWall(x, y, direction) ? '1' : '0';
+                size += 2;
             }
+            data[size] = '\n';
+            size += 1;
         }
     }
+    bytes->resize(size);
+}
 
-    if (numberOfBits != 0) {
-        file.put(toWrite >> (8 - numberOfBits));
+void MazeFileUtilities::setTileWall(unsigned char* tileWalls, Direction direction, bool isWall) {
+    unsigned char bit = 1 << DIRECTIONS().indexOf(direction);
+    if (isWall) {
+        *tileWalls |= bit;
     }
-
-    if (numberOfBytes != 0) {
-        for (auto i = 0; i < (7 - numberOfBytes); i += 1 {
-            file.put(0); // Padding so the number of bytes is a muliple of 8
-        }
+    else {
+        *tileWalls &= ~bit;
     }
-
-    // Make sure to close the file
-    file.close();
-
-    // Return success
-    return true;
-    */
-    throw std::exception();
 }
 
-QByteArray MazeFileUtilities::serializeNumType(const BasicMaze& maze) {
-
-    // TODO: MACK - FIXME
-    /*
-    // Create the stream
-    std::ofstream file(mazeFilePath.toStdString(), std::ios::trunc);
-
-    // Make sure the file is open
-    if (!file.is_open()) {
-        return false;
-    }
-
-    // Write to the file
-    for (int x = 0; x < maze.size(); x += 1) {
-        for (int y = 0; y < maze.at(x).size(); y += 1) {
-            file << x << " " << y;
-            for (Direction direction : DIRECTIONS()) {
-                file << " " << (maze.at(x).at(y).at(direction) ? 1 : 0);
-            }
-            file << "\n"; // std::endl flushes the buffer everytime its called
+BasicMaze MazeFileUtilities::fromColumns(const QVector<QVector<unsigned char>>& columns) {
+    int width = columns.size();
+    int height = 0 < width ? columns.at(0).size() : 0;
+    QVector<unsigned char> tileWalls(width * height);
+    for (int x = 0; x < width; x += 1) {
+        if (columns.at(x).size() != height) {
+            throw std::runtime_error("Non-rectangular maze");
+        }
+        for (int y = 0; y < height; y += 1) {
+            tileWalls[y * width + x] = columns.at(x).at(y);
         }
     }
-
-    // Make sure to close the file
-    file.close();
-
-    // Return success
-    return true;
-    */
-    throw std::exception();
+    return BasicMaze::fromTileWalls(width, height, tileWalls);
 }
 
 } //namespace mms
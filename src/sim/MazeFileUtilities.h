@@ -2,8 +2,10 @@
 
 #include <QByteArray>
 #include <QString>
+#include <QVector>
 
 #include "BasicMaze.h"
+#include "Direction.h"
 #include "MazeFileType.h"
 
 namespace mms {
@@ -17,22 +19,52 @@ public:
     static BasicMaze load(const QString& path);
     static BasicMaze loadBytes(const QByteArray& bytes);
 
+    // Writes the maze to the given path; throws on failure
     static void save(
         const BasicMaze& maze,
         const QString& path,
         MazeFileType type);
 
+    // Writes many mazes at once: a single file for corpus files, otherwise
+    // one file per maze, numbered after the given path. The mazes must all
+    // be in memory; to stream mazes into a corpus, use MazeCorpusWriter.
+    static void saveBatch(
+        const QVector<BasicMaze>& mazes,
+        const QString& path,
+        MazeFileType type);
+
+    // Serializes the maze; the second form reuses the buffer's capacity
+    static QByteArray serialize(const BasicMaze& maze, MazeFileType type);
+    static void serialize(const BasicMaze& maze, MazeFileType type, QByteArray* bytes);
+
+    // Guesses the file type from the size and contents of the bytes
+    static MazeFileType sniffType(const QByteArray& bytes);
+
 private:
 
+    // The sniffed type first, followed by the remaining types
+    static QVector<MazeFileType> getCandidateTypes(const QByteArray& bytes);
+
+    // Splits the bytes into lines that refer to, rather than copy, the bytes
+    static QVector<QByteArray> splitLines(const QByteArray& bytes);
+
+    static BasicMaze deserialize(const QByteArray& bytes, MazeFileType type);
     static BasicMaze deserializeMapType(const QByteArray& bytes);
     static BasicMaze deserializeMazType(const QByteArray& bytes);
     static BasicMaze deserializeMz2Type(const QByteArray& bytes);
     static BasicMaze deserializeNumType(const QByteArray& bytes);
 
-    static QByteArray serializeMapType(const BasicMaze& maze);
-    static QByteArray serializeMazType(const BasicMaze& maze);
-    static QByteArray serializeMz2Type(const BasicMaze& maze);
-    static QByteArray serializeNumType(const BasicMaze& maze);
+    static void serializeMapType(const BasicMaze& maze, QByteArray* bytes);
+    static void serializeMazType(const BasicMaze& maze, QByteArray* bytes);
+    static void serializeMz2Type(const BasicMaze& maze, QByteArray* bytes);
+    static void serializeNumType(const BasicMaze& maze, QByteArray* bytes);
+
+    static void writeFile(const QString& path, const QByteArray& bytes);
+
+    // Helpers for the formats that list the walls of each tile separately;
+    // bit i of a tile's walls is set if DIRECTIONS().at(i) is a wall
+    static void setTileWall(unsigned char* tileWalls, Direction direction, bool isWall);
+    static BasicMaze fromColumns(const QVector<QVector<unsigned char>>& columns);
 };
 
 } // namespace mms
@@ -8,6 +8,7 @@
 #include <QTableWidget>
 #include <QVBoxLayout>
 
+#include "MazeCorpus.h"
 #include "MazeFileType.h"
 #include "Resources.h"
 #include "SettingsMazeFiles.h"
@@ -83,6 +84,15 @@ void MazeFilesTab::remove() {
     const auto& selected = m_table->selectedItems();
     ASSERT_LT(0, selected.size());
     QString path = m_table->item(m_table->currentRow(), 1)->text();
+    // Removing any maze of a corpus removes the whole corpus file
+    QString corpusPath;
+    int corpusIndex = 0;
+    if (
+        !QFileInfo::exists(path) &&
+        MazeCorpus::parseEntryPath(path, &corpusPath, &corpusIndex)
+    ) {
+        path = corpusPath;
+    }
     SettingsMazeFiles::removeMazeFile(path);
     refresh();
 }
@@ -94,12 +104,34 @@ void MazeFilesTab::refresh() {
     QStringList mazeFiles;
     mazeFiles += Resources::getMazes();
     mazeFiles += SettingsMazeFiles::getSettingsMazeFiles();
-    m_table->setRowCount(mazeFiles.size());
-    for (int i = 0; i < mazeFiles.size(); i += 1) {
-        QString path = mazeFiles.at(i);
-        QString name = QFileInfo(path).fileName();
-        m_table->setItem(i, 0, new QTableWidgetItem(name));
-        m_table->setItem(i, 1, new QTableWidgetItem(path));
+
+    // Corpus files are expanded into one row per maze; only the header and
+    // index are read here, the mazes themselves are loaded on selection
+    QStringList names;
+    QStringList paths;
+    for (const QString& path : mazeFiles) {
+        QFileInfo info(path);
+        if (info.suffix().toLower() == MAZE_FILE_TYPE_TO_SUFFIX().value(MazeFileType::MZC)) {
+            try {
+                MazeCorpus corpus(path);
+                for (int i = 0; i < corpus.size(); i += 1) {
+                    names.append(info.fileName() + " #" + QString::number(i));
+                    paths.append(MazeCorpus::getEntryPath(path, i));
+                }
+                continue;
+            }
+            catch (...) {
+                // Fall through, and list the file as-is
+            }
+        }
+        names.append(info.fileName());
+        paths.append(path);
+    }
+
+    m_table->setRowCount(paths.size());
+    for (int i = 0; i < paths.size(); i += 1) {
+        m_table->setItem(i, 0, new QTableWidgetItem(names.at(i)));
+        m_table->setItem(i, 1, new QTableWidgetItem(paths.at(i)));
     }
     m_table->resizeColumnsToContents();
 }
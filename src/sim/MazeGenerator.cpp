@@ -0,0 +1,70 @@
+#include "MazeGenerator.h"
+
+#include <QVector>
+
+#include <map>
+#include <random>
+#include <vector>
+
+#include "../maze/algos/random_c++/Algo.h"
+#include "../maze/algos/tomasz/Algo.h"
+
+namespace mms {
+
+template<typename Algo, typename Interface>
+BasicMaze MazeGenerator::run(int width, int height, quint32 seed) {
+
+    // Start with an empty maze, exactly as the generators' main() does
+    std::map<char, bool> cell {{'n', false}, {'e', false}, {'s', false}, {'w', false}};
+    std::vector<std::vector<std::map<char, bool>>> maze(
+        width,
+        std::vector<std::map<char, bool>>(height, cell));
+
+    std::mt19937 generator(seed);
+    bool success = true;
+    Interface interface(&maze, &success, &generator);
+    Algo().generate(&interface);
+    if (!success) {
+        throw std::runtime_error("maze generator failed");
+    }
+
+    // The generator keeps both sides of each wall in sync, but the walls
+    // are converted per tile anyway, so that any disagreement is flagged
+    static const char directions[] = {'n', 'e', 's', 'w'};
+    QVector<unsigned char> tileWalls(width * height, 0);
+    for (int y = 0; y < height; y += 1) {
+        for (int x = 0; x < width; x += 1) {
+            unsigned char walls = 0;
+            for (int i = 0; i < 4; i += 1) {
+                if (maze.at(x).at(y).at(directions[i])) {
+                    walls |= (1 << i);
+                }
+            }
+            tileWalls[y * width + x] = walls;
+        }
+    }
+    return BasicMaze::fromTileWalls(width, height, tileWalls);
+}
+
+QStringList MazeGenerator::getNames() {
+    return {"tomasz", "random_c++"};
+}
+
+BasicMaze MazeGenerator::generate(
+        const QString& name,
+        int width,
+        int height,
+        quint32 seed) {
+    if (width <= 0 || height <= 0) {
+        throw std::runtime_error("maze dimensions must be positive");
+    }
+    if (name == "tomasz") {
+        return run<tomasz::Algo, tomasz::Interface>(width, height, seed);
+    }
+    if (name == "random_c++") {
+        return run<random_cpp::Algo, random_cpp::Interface>(width, height, seed);
+    }
+    throw std::runtime_error("unknown maze generator");
+}
+
+} // namespace mms
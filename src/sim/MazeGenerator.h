@@ -0,0 +1,39 @@
+#pragma once
+
+#include <QString>
+#include <QStringList>
+
+#include "BasicMaze.h"
+
+namespace mms {
+
+// Runs the built-in maze generation algorithms (see src/maze/algos)
+// in-process, rather than as a separate process per maze. Each call uses its
+// own random number generator, so generators may run on many threads at
+// once, and the seed alone determines the maze.
+class MazeGenerator {
+
+public:
+
+    MazeGenerator() = delete;
+
+    // The names of the generators that are compiled into the simulator,
+    // which match the names of their directories
+    static QStringList getNames();
+
+    // Throws if the generator doesn't exist or fails
+    static BasicMaze generate(
+        const QString& name,
+        int width,
+        int height,
+        quint32 seed);
+
+private:
+
+    // Runs one of the generators, given its algorithm and interface types
+    template<typename Algo, typename Interface>
+    static BasicMaze run(int width, int height, quint32 seed);
+
+};
+
+} // namespace mms
@@ -0,0 +1,145 @@
+#include "MazeGeometry.h"
+
+#include <algorithm>
+
+#include "Assert.h"
+#include "Param.h"
+
+namespace mms {
+
+const int MazeGeometry::CHUNK_SIZE = 8;
+
+MazeGeometry::MazeGeometry(const Maze* maze) :
+        m_mazeSize({maze->getWidth(), maze->getHeight()}) {
+
+    initChunks();
+
+    // Note that the position of each polygon within the buffer, and thus the
+    // order in which the polygons are drawn, is determined by the layout
+    m_positions.resize(trianglesPerTile() * m_mazeSize.first * m_mazeSize.second);
+    for (int x = 0; x < m_mazeSize.first; x += 1) {
+        for (int y = 0; y < m_mazeSize.second; y += 1) {
+            const Tile* tile = maze->getTile(x, y);
+            insertPositions(getTileGraphicBaseStartingIndex(x, y), tile->getFullPolygon());
+            for (Direction direction : DIRECTIONS()) {
+                insertPositions(
+                    getTileGraphicWallStartingIndex(x, y, direction),
+                    tile->getWallPolygon(direction));
+            }
+            QVector<Polygon> cornerPolygons = tile->getCornerPolygons();
+            for (int i = 0; i < cornerPolygons.size(); i += 1) {
+                insertPositions(
+                    getTileGraphicCornerStartingIndex(x, y, i),
+                    cornerPolygons.at(i));
+            }
+            insertPositions(getTileGraphicFogStartingIndex(x, y), tile->getFullPolygon());
+        }
+    }
+}
+
+int MazeGeometry::trianglesPerTile() {
+    // This value must be predetermined, and was done so as follows:
+    // Base polygon:      2 (2 triangles x 1 polygon  per tile)
+    // Wall polygon:      8 (2 triangles x 4 polygons per tile)
+    // Corner polygon:    8 (2 triangles x 4 polygons per tile)
+    // Fog polygon:       2 (2 triangles x 1 polygon  per tile)
+    // --------------------
+    // Total             20
+    return 20;
+}
+
+int MazeGeometry::size() const {
+    return m_positions.size();
+}
+
+const QVector<TrianglePosition>* MazeGeometry::getPositions() const {
+    return &m_positions;
+}
+
+const QVector<BufferChunk>& MazeGeometry::getChunks() const {
+    return m_chunks;
+}
+
+void MazeGeometry::getChunkLayout(int x, int y, int* tilesBeforeChunk, int* tilesInChunk, int* indexInChunk) const {
+    int chunkX = x / CHUNK_SIZE;
+    int chunkY = y / CHUNK_SIZE;
+    int chunkWidth = std::min(CHUNK_SIZE, m_mazeSize.first - chunkX * CHUNK_SIZE);
+    int chunkHeight = std::min(CHUNK_SIZE, m_mazeSize.second - chunkY * CHUNK_SIZE);
+    *tilesBeforeChunk =
+        chunkX * CHUNK_SIZE * m_mazeSize.second +
+        chunkY * CHUNK_SIZE * chunkWidth;
+    *tilesInChunk = chunkWidth * chunkHeight;
+    *indexInChunk =
+        (x - chunkX * CHUNK_SIZE) * chunkHeight +
+        (y - chunkY * CHUNK_SIZE);
+}
+
+int MazeGeometry::getTileGraphicBaseStartingIndex(int x, int y) const {
+    int before, count, index;
+    getChunkLayout(x, y, &before, &count, &index);
+    return trianglesPerTile() * before + 2 * index;
+}
+
+int MazeGeometry::getTileGraphicWallStartingIndex(int x, int y, Direction direction) const {
+    int before, count, index;
+    getChunkLayout(x, y, &before, &count, &index);
+    return trianglesPerTile() * before + 2 * count + 8 * index + 2 * DIRECTIONS().indexOf(direction);
+}
+
+int MazeGeometry::getTileGraphicCornerStartingIndex(int x, int y, int cornerNumber) const {
+    int before, count, index;
+    getChunkLayout(x, y, &before, &count, &index);
+    return trianglesPerTile() * before + 10 * count + 8 * index + 2 * cornerNumber;
+}
+
+int MazeGeometry::getTileGraphicFogStartingIndex(int x, int y) const {
+    int before, count, index;
+    getChunkLayout(x, y, &before, &count, &index);
+    return trianglesPerTile() * before + 18 * count + 2 * index;
+}
+
+void MazeGeometry::initChunks() {
+
+    // The maze spans an extra half wall width on each side, since the
+    // physical point (0,0) is the middle of the bottom-left corner piece
+    double tileLength = P()->wallLength() + P()->wallWidth();
+    double halfWallWidth = P()->wallWidth() / 2.0;
+
+    m_chunks.clear();
+    for (int x = 0; x < m_mazeSize.first; x += CHUNK_SIZE) {
+        for (int y = 0; y < m_mazeSize.second; y += CHUNK_SIZE) {
+            int tilesBeforeChunk = 0;
+            int tilesInChunk = 0;
+            int indexInChunk = 0;
+            getChunkLayout(x, y, &tilesBeforeChunk, &tilesInChunk, &indexInChunk);
+            int chunkWidth = std::min(CHUNK_SIZE, m_mazeSize.first - x);
+            int chunkHeight = std::min(CHUNK_SIZE, m_mazeSize.second - y);
+            BufferChunk chunk;
+            chunk.minX = x * tileLength - halfWallWidth;
+            chunk.minY = y * tileLength - halfWallWidth;
+            chunk.maxX = (x + chunkWidth) * tileLength + halfWallWidth;
+            chunk.maxY = (y + chunkHeight) * tileLength + halfWallWidth;
+            chunk.graphicStart = trianglesPerTile() * tilesBeforeChunk;
+            chunk.graphicCount = trianglesPerTile() * tilesInChunk;
+            chunk.cornerStart = chunk.graphicStart + 10 * tilesInChunk;
+            chunk.cornerCount = 8 * tilesInChunk;
+            chunk.textureStart = 0;
+            chunk.textureCount = 0;
+            m_chunks.append(chunk);
+        }
+    }
+}
+
+void MazeGeometry::insertPositions(int index, const Polygon& polygon) {
+    // All tile polygons are convex quadrilaterals, so we can split them
+    // along a diagonal rather than performing a general triangulation
+    ASSERT_EQ(polygon.size(), 4);
+    VertexPosition p[4];
+    for (int i = 0; i < 4; i += 1) {
+        p[i] = {polygon.getX(i), polygon.getY(i)};
+    }
+    m_positions[index] = {p[0], p[1], p[2]};
+    m_positions[index + 1] = {p[0], p[2], p[3]};
+}
+
+} // namespace mms
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <QPair>
+#include <QVector>
+
+#include "BufferChunk.h"
+#include "Direction.h"
+#include "Maze.h"
+#include "Polygon.h"
+#include "TrianglePosition.h"
+
+namespace mms {
+
+// The immutable positions of the tile triangles of a maze. These are the
+// same for the truth and for every view of the maze, so they're computed
+// once per maze and shared; each view only stores the colors of the
+// triangles, at the same indices (see BufferInterface).
+class MazeGeometry {
+
+public:
+
+    MazeGeometry(const Maze* maze);
+
+    // The width and height, in tiles, of each chunk (smaller at the edges)
+    static const int CHUNK_SIZE;
+
+    // The number of triangles of each tile
+    static int trianglesPerTile();
+
+    // The total number of triangles, and their positions
+    int size() const;
+    const QVector<TrianglePosition>* getPositions() const;
+
+    // Returns the chunks, in buffer order. Only the bounds and the graphic
+    // ranges are set, since the texture ranges depend on the view.
+    const QVector<BufferChunk>& getChunks() const;
+
+    // Tiles are ordered chunk by chunk (column-major, both across and within
+    // chunks), so that each chunk occupies a contiguous range of the buffers.
+    // Within a chunk, triangles are further grouped by kind (all bases, then
+    // all walls, all corners, and all fog) so that corners can be skipped.
+    void getChunkLayout(int x, int y, int* tilesBeforeChunk, int* tilesInChunk, int* indexInChunk) const;
+
+    // Retrieve the indices of each specific type of Tile triangle
+    int getTileGraphicBaseStartingIndex(int x, int y) const;
+    int getTileGraphicWallStartingIndex(int x, int y, Direction direction) const;
+    int getTileGraphicCornerStartingIndex(int x, int y, int cornerNumber) const;
+    int getTileGraphicFogStartingIndex(int x, int y) const;
+
+private:
+
+    // The width and height of the maze
+    QPair<int, int> m_mazeSize;
+
+    QVector<TrianglePosition> m_positions;
+    QVector<BufferChunk> m_chunks;
+
+    void initChunks();
+
+    // Writes the two triangles of a quadrilateral at the given index
+    void insertPositions(int index, const Polygon& polygon);
+
+};
+
+} // namespace mms
@@ -11,7 +11,8 @@ MazeGraphic::MazeGraphic(
         bool tileColorsVisible,
         bool tileFogVisible,
         bool tileTextVisible,
-        bool autopopulateTextWithDistance) {
+        bool autopopulateTextWithDistance) :
+        m_bufferInterface(bufferInterface) {
     for (int x = 0; x < maze->getWidth(); x += 1) {
         QVector<TileGraphic> column;
         for (int y = 0; y < maze->getHeight(); y += 1) {
@@ -89,6 +90,7 @@ void MazeGraphic::setTileTextVisible(bool visible) {
 
 void MazeGraphic::drawPolygons() const {
     // Fill the GRAPHIC_CPU_BUFFER
+    m_bufferInterface->allocateGraphicCpuBuffer();
     for (int x = 0; x < m_tileGraphics.size(); x += 1) {
         for (int y = 0; y < m_tileGraphics.at(x).size(); y += 1) {
             m_tileGraphics.at(x).at(y).drawPolygons();
@@ -98,6 +100,7 @@ void MazeGraphic::drawPolygons() const {
 
 void MazeGraphic::drawTextures() {
     // Fill the TEXTURE_CPU_BUFFER
+    m_bufferInterface->allocateTextureCpuBuffer();
     for (int x = 0; x < m_tileGraphics.size(); x += 1) {
         for (int y = 0; y < m_tileGraphics.at(x).size(); y += 1) {
             m_tileGraphics[x][y].drawTextures();
@@ -40,6 +40,7 @@ public:
 
 private:
 
+    BufferInterface* m_bufferInterface;
     QVector<QVector<TileGraphic>> m_tileGraphics;
 
     int getWidth() const;
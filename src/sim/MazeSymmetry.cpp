@@ -0,0 +1,95 @@
+#include "MazeSymmetry.h"
+
+namespace mms {
+
+MazeSymmetry::MazeSymmetry() : MazeSymmetry(0, false) {
+}
+
+MazeSymmetry::MazeSymmetry(int rotations, bool mirrored) :
+        m_rotations(((rotations % 4) + 4) % 4),
+        m_mirrored(mirrored) {
+}
+
+QVector<MazeSymmetry> MazeSymmetry::all() {
+    QVector<MazeSymmetry> symmetries;
+    for (bool mirrored : {false, true}) {
+        for (int rotations = 0; rotations < 4; rotations += 1) {
+            symmetries.append(MazeSymmetry(rotations, mirrored));
+        }
+    }
+    return symmetries;
+}
+
+int MazeSymmetry::getRotations() const {
+    return m_rotations;
+}
+
+bool MazeSymmetry::isMirrored() const {
+    return m_mirrored;
+}
+
+bool MazeSymmetry::isIdentity() const {
+    return m_rotations == 0 && !m_mirrored;
+}
+
+MazeSymmetry MazeSymmetry::then(const MazeSymmetry& other) const {
+    // Mirroring reverses the sense of any rotation that precedes it, so
+    // mirror * rotate(r) == rotate(-r) * mirror
+    int rotations = other.m_mirrored ? -m_rotations : m_rotations;
+    return MazeSymmetry(
+        rotations + other.m_rotations,
+        m_mirrored != other.m_mirrored);
+}
+
+int MazeSymmetry::getWidth(int sourceWidth, int sourceHeight) const {
+    return m_rotations % 2 == 0 ? sourceWidth : sourceHeight;
+}
+
+int MazeSymmetry::getHeight(int sourceWidth, int sourceHeight) const {
+    return m_rotations % 2 == 0 ? sourceHeight : sourceWidth;
+}
+
+QPair<int, int> MazeSymmetry::toSource(
+        int x,
+        int y,
+        int sourceWidth,
+        int sourceHeight) const {
+
+    // Undo the rotations, in terms of the transformed maze's dimensions
+    int width = getWidth(sourceWidth, sourceHeight);
+    int height = getHeight(sourceWidth, sourceHeight);
+    int sourceX = x;
+    int sourceY = y;
+    switch (m_rotations) {
+        case 1:
+            sourceX = y;
+            sourceY = width - 1 - x;
+            break;
+        case 2:
+            sourceX = width - 1 - x;
+            sourceY = height - 1 - y;
+            break;
+        case 3:
+            sourceX = height - 1 - y;
+            sourceY = x;
+            break;
+    }
+
+    // Then undo the mirroring
+    if (m_mirrored) {
+        sourceX = sourceWidth - 1 - sourceX;
+    }
+    return {sourceX, sourceY};
+}
+
+Direction MazeSymmetry::toSource(Direction direction) const {
+    // Counter-clockwise turns are undone by turning clockwise, which is the
+    // next direction in DIRECTIONS(), and mirroring swaps east and west
+    int index = (static_cast<int>(direction) + m_rotations) % 4;
+    if (m_mirrored && index % 2 == 1) {
+        index = (index + 2) % 4;
+    }
+    return static_cast<Direction>(index);
+}
+
+} // namespace mms
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <QPair>
+#include <QVector>
+
+#include "Direction.h"
+
+namespace mms {
+
+// One of the eight symmetries of a (rectangular) maze: an optional mirroring
+// across the vertical, followed by some number of counter-clockwise quarter
+// turns. A symmetry maps the coordinates of a source maze to the coordinates
+// of the transformed maze; the to* methods go the other way, so that the
+// transformed maze can be read through on access, without being copied.
+class MazeSymmetry {
+
+public:
+
+    // The identity
+    MazeSymmetry();
+    MazeSymmetry(int rotations, bool mirrored);
+
+    // All eight symmetries, starting with the identity
+    static QVector<MazeSymmetry> all();
+
+    int getRotations() const;
+    bool isMirrored() const;
+    bool isIdentity() const;
+
+    // The symmetry equivalent to applying this one, followed by the other one
+    MazeSymmetry then(const MazeSymmetry& other) const;
+
+    // The dimensions of the transformed maze
+    int getWidth(int sourceWidth, int sourceHeight) const;
+    int getHeight(int sourceWidth, int sourceHeight) const;
+
+    // Maps a tile or direction of the transformed maze to the source maze
+    QPair<int, int> toSource(int x, int y, int sourceWidth, int sourceHeight) const;
+    Direction toSource(Direction direction) const;
+
+private:
+
+    int m_rotations;
+    bool m_mirrored;
+
+};
+
+} // namespace mms
@@ -0,0 +1,15 @@
+#pragma once
+
+namespace mms {
+
+enum class MazeValidity {
+    INVALID,
+    // Maze can be rendered
+    DRAWABLE,
+    // Maze be explored by a mouse
+    EXPLORABLE,
+    // Maze follows official guidelines
+    OFFICIAL,
+};
+
+} // namespace mms
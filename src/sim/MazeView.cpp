@@ -8,13 +8,15 @@ namespace mms {
 
 MazeView::MazeView(
         const Maze* maze,
+        const MazeGeometry* mazeGeometry,
         bool wallTruthVisible,
         bool tileColorsVisible,
         bool tileFogVisible,
         bool tileTextVisible,
         bool autopopulateTextWithDistance) :
+        m_mazeGeometry(mazeGeometry),
         m_bufferInterface(
-            {maze->getWidth(), maze->getHeight()},
+            mazeGeometry,
             &m_graphicCpuBuffer,
             &m_textureCpuBuffer),
         m_mazeGraphic(
@@ -42,7 +44,11 @@ void MazeView::initTileGraphicText(int numRows, int numCols) {
     initText(numRows, numCols);
 }
 
-const QVector<TriangleGraphic>* MazeView::getGraphicCpuBuffer() const {
+const MazeGeometry* MazeView::getMazeGeometry() const {
+    return m_mazeGeometry;
+}
+
+const QVector<TriangleColor>* MazeView::getGraphicCpuBuffer() const {
     return &m_graphicCpuBuffer;
 }
 
@@ -50,6 +56,18 @@ const QVector<TriangleTexture>* MazeView::getTextureCpuBuffer() const {
     return &m_textureCpuBuffer;
 }
 
+QVector<QPair<int, int>> MazeView::takeDirtyGraphicRanges() {
+    return m_bufferInterface.takeDirtyGraphicRanges();
+}
+
+QVector<QPair<int, int>> MazeView::takeDirtyTextureRanges() {
+    return m_bufferInterface.takeDirtyTextureRanges();
+}
+
+const QVector<BufferChunk>& MazeView::getChunks() const {
+    return m_bufferInterface.getChunks();
+}
+
 void MazeView::initText(int numRows, int numCols) {
 
     // Initialze the tile text in the buffer class,
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <QPair>
 #include <QVector>
 
+#include "BufferChunk.h"
 #include "BufferInterface.h"
 #include "Maze.h"
+#include "MazeGeometry.h"
 #include "MazeGraphic.h"
-#include "TriangleGraphic.h"
+#include "TriangleColor.h"
 #include "TriangleTexture.h"
 
 namespace mms {
@@ -16,6 +19,7 @@ public:
 
     MazeView(
         const Maze* maze,
+        const MazeGeometry* mazeGeometry,
         bool wallTruthVisible, 
         bool tileColorsVisible, 
         bool tileFogVisible, 
@@ -24,13 +28,26 @@ public:
 
     MazeGraphic* getMazeGraphic();
     void initTileGraphicText(int numRows, int numCols);
-    const QVector<TriangleGraphic>* getGraphicCpuBuffer() const;
+    const MazeGeometry* getMazeGeometry() const;
+    const QVector<TriangleColor>* getGraphicCpuBuffer() const;
     const QVector<TriangleTexture>* getTextureCpuBuffer() const;
 
+    // The ranges of the buffers that have changed since they were last taken
+    // (see BufferInterface), so that only those have to be uploaded
+    QVector<QPair<int, int>> takeDirtyGraphicRanges();
+    QVector<QPair<int, int>> takeDirtyTextureRanges();
+
+    // The spatial chunks of the buffers, used for culling
+    const QVector<BufferChunk>& getChunks() const;
+
 private:
 
-    // These vectors contain the triangles that will actually be drawn
-    QVector<TriangleGraphic> m_graphicCpuBuffer;
+    // The positions of the tile triangles, shared with other views
+    const MazeGeometry* m_mazeGeometry;
+
+    // These vectors contain the triangles that will actually be drawn; the
+    // graphic buffer holds only colors, parallel to the shared positions
+    QVector<TriangleColor> m_graphicCpuBuffer;
     QVector<TriangleTexture> m_textureCpuBuffer;
 
     // The buffer interface provides abstractions which the MazeGraphic
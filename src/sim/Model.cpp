@@ -24,19 +24,21 @@ Model::Model() :
 
 void Model::start() {
 
+    // The mouse is integrated exactly along arcs (or with RK4), so the step
+    // only needs to be small enough for the interface to react in time
+    double dt = P()->timeStep();
     double prev = SimUtilities::getHighResTimestamp();
     double acc = 0.0;
     while (!m_shutdownRequested) {
         double now = SimUtilities::getHighResTimestamp();
         acc += (now - prev) * m_simSpeed;
         prev = now;
-        while (acc >= DT) {
-            update(DT);
-            acc -= DT;
-            // TODO: MACK - check for collisions ...
-            // std::thread collisionDetector(&Model::checkCollision, this);
+        while (acc >= dt) {
+            update(dt);
+            checkCollision();
+            acc -= dt;
         }
-        SimUtilities::sleep(Duration::Seconds(DT / 2.0));
+        SimUtilities::sleep(Duration::Seconds(dt / 2.0));
     };
 }
 
@@ -169,64 +171,24 @@ void Model::setSimSpeed(double factor) {
 
 void Model::checkCollision() {
 
-    // If collision detectino isn't enabled, let this thread exit
-    // if (!P()->collisionDetectionEnabled()) {
-    //     return;
-    // }
+    // Ensure the maze/mouse aren't changed during the check
+    m_mutex.lock();
 
-    // TODO: MACK
-    // If the interface type is DISCRETE, let this thread exit
-    if (true) {
+    if (m_mouse == nullptr || m_paused || m_mouse->didCrash()) {
+        m_mutex.unlock();
         return;
     }
 
-    /*
-    while (true) {
-
-        // In order to ensure we're sleeping the correct amount of time, we time
-        // the collision detection operation and take it into account when we sleep.
-        double start(mms::SimUtilities::getHighResTimestamp());
-
-        // We declare these statically since we only need one copy of them
-        static const Meters halfWallWidth = Meters(P()->wallWidth() / 2.0);
-        static const Meters tileLength = Meters(P()->wallLength() + P()->wallWidth());
-
-        // Retrieve the current collision polygon
-        QVector<Cartesian> currentCollisionPolygonVertices =
-            m_mouse->getCurrentCollisionPolygon(
-                m_mouse->getCurrentTranslation(), m_mouse->getCurrentRotation()).getVertices();
-
-        // Check for collisions
-        for (int i = 0; i < currentCollisionPolygonVertices.size(); i += 1) {
-            int j = (i + 1) % currentCollisionPolygonVertices.size();
-            Cartesian v1 = currentCollisionPolygonVertices.at(i);
-            Cartesian v2 = currentCollisionPolygonVertices.at(j);
-            // If a wall has come between the two vertices, then we have a collision
-            if (GeometryUtilities::castRay(v1, v2, *m_maze, halfWallWidth, tileLength) != v2) {
-                S()->setCrashed();
-                return; // If we've crashed, let this thread exit
-            }
-        }
-
-        // Get the duration of the collision detection, in seconds
-        double end(mms::SimUtilities::getHighResTimestamp());
-        double duration = end - start;
-
-        // Notify the use of a late collision detection
-        // TODO: MACK - make some variables for these long expressions
-        if (P()->printLateCollisionDetections() && duration > 1.0 / P()->collisionDetectionRate()) {
-            qWarning().noquote().nospace()
-                << "A collision detection was late by "
-                << (duration - 1.0/P()->collisionDetectionRate())
-                << " seconds, which is "
-                << (duration - 1.0/P()->collisionDetectionRate())/(1.0/P()->collisionDetectionRate()) * 100
-                << " percent late.";
-        }
-
-        // Sleep the appropriate amout of time, based on the collision detection duration
-        mms::SimUtilities::sleep(mms::Seconds(std::max(0.0, 1.0 / P()->collisionDetectionRate() - duration)));
+    // The collision shape is exact, and dismisses walls and posts that are
+    // far away with a single distance test, so this is cheap enough to run
+    // on every update
+    if (m_mouse->isColliding(
+            m_mouse->getCurrentTranslation(),
+            m_mouse->getCurrentRotation())) {
+        m_mouse->setCrashed();
     }
-    */
+
+    m_mutex.unlock();
 }
 
 } // namespace mms
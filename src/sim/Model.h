@@ -34,8 +34,8 @@ signals:
 
 private:
 
-    // A fixed timestep (in sim time)
-    static constexpr double DT = 0.001;
+    // Advances the sim by a fixed timestep (in sim time), as given by the
+    // time-step parameter
     void update(double dt);
 
     mutable QMutex m_mutex;
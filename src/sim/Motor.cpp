@@ -0,0 +1,101 @@
+#include "Motor.h"
+
+#include <QtMath>
+
+#include <limits>
+
+#include "Assert.h"
+
+namespace mms {
+
+Motor::Motor() :
+    m_maxAcceleration(std::numeric_limits<double>::infinity()),
+    m_maxDeceleration(std::numeric_limits<double>::infinity()),
+    m_timeConstant(0.0) {
+}
+
+Motor::Motor(
+    const AngularAcceleration& maxAcceleration,
+    const AngularAcceleration& maxDeceleration,
+    const Duration& timeConstant,
+    const QVector<QPair<AngularVelocity, double>>& torqueCurve
+) :
+    m_maxAcceleration(maxAcceleration.getRadiansPerSecondSquared()),
+    m_maxDeceleration(maxDeceleration.getRadiansPerSecondSquared()),
+    m_timeConstant(timeConstant.getSeconds()) {
+    ASSERT_LT(0.0, m_maxAcceleration);
+    ASSERT_LT(0.0, m_maxDeceleration);
+    ASSERT_LE(0.0, m_timeConstant);
+    for (int i = 0; i < torqueCurve.size(); i += 1) {
+        double speed = std::abs(torqueCurve.at(i).first.getRadiansPerSecond());
+        double fraction = torqueCurve.at(i).second;
+        ASSERT_LE(0.0, fraction);
+        ASSERT_LE(fraction, 1.0);
+        if (0 < i) {
+            ASSERT_LT(m_torqueCurve.last().first, speed);
+        }
+        else {
+            ASSERT_LT(0.0, fraction);
+        }
+        m_torqueCurve.append({speed, fraction});
+    }
+}
+
+bool Motor::isIdeal() const {
+    return (
+        std::isinf(m_maxAcceleration) &&
+        std::isinf(m_maxDeceleration) &&
+        m_timeConstant == 0.0
+    );
+}
+
+AngularVelocity Motor::getNextSpeed(
+        const AngularVelocity& currentSpeed,
+        const AngularVelocity& targetSpeed,
+        const Duration& elapsed) const {
+
+    // NOTE: This is a performance critical function
+
+    double current = currentSpeed.getRadiansPerSecond();
+    double target = targetSpeed.getRadiansPerSecond();
+    double dt = elapsed.getSeconds();
+
+    // The first-order response, which decays exponentially toward the target
+    double desired = target;
+    if (0.0 < m_timeConstant) {
+        desired = current + (target - current) * (1.0 - std::exp(-dt / m_timeConstant));
+    }
+
+    // The acceleration limits, where we're speeding up if we're moving away
+    // from zero, in which case the motor is also limited by its torque
+    double delta = desired - current;
+    bool speedingUp = 0.0 <= current * delta;
+    double limit = dt * (speedingUp
+        ? m_maxAcceleration * getTorqueFraction(std::abs(current))
+        : m_maxDeceleration);
+    if (limit < std::abs(delta)) {
+        delta = std::copysign(limit, delta);
+    }
+
+    return AngularVelocity::RadiansPerSecond(current + delta);
+}
+
+double Motor::getTorqueFraction(double speed) const {
+    if (m_torqueCurve.isEmpty()) {
+        return 1.0;
+    }
+    if (speed <= m_torqueCurve.first().first) {
+        return m_torqueCurve.first().second;
+    }
+    for (int i = 1; i < m_torqueCurve.size(); i += 1) {
+        const QPair<double, double>& lower = m_torqueCurve.at(i - 1);
+        const QPair<double, double>& upper = m_torqueCurve.at(i);
+        if (speed <= upper.first) {
+            return lower.second + (upper.second - lower.second) *
+                (speed - lower.first) / (upper.first - lower.first);
+        }
+    }
+    return m_torqueCurve.last().second;
+}
+
+} // namespace mms
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <QPair>
+#include <QVector>
+
+#include "units/AngularAcceleration.h"
+#include "units/AngularVelocity.h"
+#include "units/Duration.h"
+
+namespace mms {
+
+// The motor that drives a wheel, which determines how quickly the wheel can
+// get from its current speed to the speed it's been told to go. The motor is
+// characterized by:
+//
+// - The max acceleration and deceleration, i.e., the most that the speed can
+//   change per second when speeding up and slowing down, respectively
+// - The time constant of the first-order response of the speed to a change
+//   in the target speed, if any
+// - The torque curve, i.e., the fraction of the max acceleration that's
+//   available at a particular speed, given as (speed, fraction) points that
+//   are linearly interpolated between (and held constant beyond). The
+//   torque at the lowest speed must be nonzero, or the wheel couldn't start.
+//
+// A default constructed motor is ideal, i.e., the wheel reaches any speed
+// instantly, which is what happens when the mouse file doesn't specify one.
+//
+// Note that the motor only shapes the speeds set through the continuous
+// interface; the discrete movements stop the wheels immediately at the end
+// of each move (see Mouse::stopAllWheels).
+class Motor {
+
+public:
+
+    Motor();
+    Motor(
+        const AngularAcceleration& maxAcceleration,
+        const AngularAcceleration& maxDeceleration,
+        const Duration& timeConstant,
+        const QVector<QPair<AngularVelocity, double>>& torqueCurve);
+
+    // Whether or not the wheel reaches any speed instantly
+    bool isIdeal() const;
+
+    // The speed of the wheel after elapsed time, starting at the current
+    // speed and heading toward the target speed; doesn't allocate, so that
+    // it can be called from the update loop
+    AngularVelocity getNextSpeed(
+        const AngularVelocity& currentSpeed,
+        const AngularVelocity& targetSpeed,
+        const Duration& elapsed) const;
+
+private:
+
+    // Infinite if there's no limit
+    double m_maxAcceleration; // rad/s^2
+    double m_maxDeceleration; // rad/s^2
+
+    // Zero if the response is immediate
+    double m_timeConstant; // s
+
+    // Sorted by speed, empty if the full acceleration is always available
+    QVector<QPair<double, double>> m_torqueCurve; // (rad/s, fraction)
+
+    // Returns the fraction of the max acceleration available at the speed
+    double getTorqueFraction(double speed) const;
+
+};
+
+} // namespace mms
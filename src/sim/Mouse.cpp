@@ -1,24 +1,34 @@
 #include "Mouse.h"
 
-#include <QMutableMapIterator>
 #include <QPair>
+#include <QStringList>
 #include <QVector>
+#include <QtConcurrent>
 #include <QtMath>
 
+#include <algorithm>
+
 #include "units/Distance.h"
+#include "units/Rotation.h"
 #include "units/Speed.h"
 
 #include "Assert.h"
+#include "CurveTurnFactorCalculator.h"
 #include "GeometryUtilities.h"
 #include "MouseParser.h"
 #include "Param.h"
+#include "PoseIntegrator.h"
+#include "SensorTableCache.h"
 #include "WheelEffect.h"
 
 namespace mms {
 
 Mouse::Mouse(const Maze* maze) :
     m_maze(maze),
-    m_crashed(false) {
+    m_crashed(false),
+    m_updateCount(0),
+    m_integratorType(STRING_TO_INTEGRATOR_TYPE().value(P()->integratorType())),
+    m_sensorTables(std::make_shared<SensorTables>()) {
 
     // The initial translation of the mouse is just the center of the starting tile
     Distance halfOfTileDistance = Distance::Meters((P()->wallLength() + P()->wallWidth()) / 2.0);
@@ -47,19 +57,97 @@ bool Mouse::reload(const QString& mouseFile) {
     // Initialize the body, wheels, and sensors, such that they have the
     // correct initial translation and rotation
     m_initialBodyPolygon = parser.getBody(m_initialTranslation, m_initialRotation, &success);
-    m_wheels = parser.getWheels(m_initialTranslation, m_initialRotation, &success);
-    m_sensors = parser.getSensors(m_initialTranslation, m_initialRotation, *m_maze, &success);
+    QMap<QString, Wheel> wheels =
+        parser.getWheels(m_initialTranslation, m_initialRotation, &success);
+    QMap<QString, Sensor> sensors =
+        parser.getSensors(m_initialTranslation, m_initialRotation, *m_maze, &success);
+    m_gyroNoise = parser.getGyroNoise(&success);
+    m_updateCount = 0;
+
+    // Resolve the names of the wheels and sensors to handles, in order of
+    // name, so that nothing after this point has to look up a name
+    m_wheels.clear();
+    m_wheelNames.clear();
+    m_wheelHandles.clear();
+    for (auto it = wheels.constBegin(); it != wheels.constEnd(); it += 1) {
+        m_wheelHandles.insert(it.key(), m_wheels.size());
+        m_wheelNames.append(it.key());
+        m_wheels.append(it.value());
+    }
+    m_sensors.clear();
+    m_sensorNames.clear();
+    m_sensorHandles.clear();
+    for (auto it = sensors.constBegin(); it != sensors.constEnd(); it += 1) {
+        m_sensorHandles.insert(it.key(), m_sensors.size());
+        m_sensorNames.append(it.key());
+        m_sensors.append(it.value());
+    }
+
+    // Precompute the sensor readings over the whole maze, if enabled, in the
+    // background. The worker gets its own copy of the walls, since the maze
+    // may be replaced before the tables are done.
+    m_sensorTables = std::make_shared<SensorTables>();
+    if (success && !P()->sensorTableDirectory().isEmpty() && !sensors.isEmpty()) {
+        std::shared_ptr<SensorTables> sensorTables = m_sensorTables;
+        std::shared_ptr<const Maze> maze(Maze::fromWalls(m_maze->getWalls()));
+        QVector<QString> sensorNames = m_sensorNames;
+        QtConcurrent::run([=]() {
+            QMap<QString, SensorTable> tables =
+                SensorTableCache::get(mouseFile, sensors, *maze);
+            if (tables.isEmpty()) {
+                return;
+            }
+            for (const QString& name : sensorNames) {
+                sensorTables->tables.append(tables.value(name));
+            }
+            sensorTables->ready = true;
+        });
+    }
 
     // Initialize the speed adjustment factors
-    m_wheelSpeedAdjustmentFactors = getWheelSpeedAdjustmentFactors(m_wheels);
+    QVector<QPair<double, double>> wheelSpeedAdjustmentFactors =
+        getWheelSpeedAdjustmentFactors(m_wheels);
 
     // Initialize the curve turn factors, based on previously determined info
-    m_curveTurnFactorCalculator = CurveTurnFactorCalculator(
+    CurveTurnFactorCalculator curveTurnFactorCalculator(
         m_wheels,
-        m_wheelSpeedAdjustmentFactors);
+        wheelSpeedAdjustmentFactors);
+
+    // Precompute the wheel speeds of each of the movement primitives, where
+    // the curves are along the edges of the tiles
+    Distance curveRadius = Distance::Meters(P()->wallLength() / 2.0);
+    QMap<MovementPrimitive, QPair<double, double>> primitiveFactors = {
+        {MovementPrimitive::FORWARD, {1.0, 0.0}},
+        {MovementPrimitive::TURN_LEFT,
+            curveTurnFactorCalculator.getCurveTurnFactors(Distance::Meters(0), true)},
+        {MovementPrimitive::TURN_RIGHT,
+            curveTurnFactorCalculator.getCurveTurnFactors(Distance::Meters(0), false)},
+        {MovementPrimitive::CURVE_LEFT,
+            curveTurnFactorCalculator.getCurveTurnFactors(curveRadius, true)},
+        {MovementPrimitive::CURVE_RIGHT,
+            curveTurnFactorCalculator.getCurveTurnFactors(curveRadius, false)},
+    };
+    m_primitives.clear();
+    for (auto it = primitiveFactors.constBegin(); it != primitiveFactors.constEnd(); it += 1) {
+        ASSERT_EQ(static_cast<int>(it.key()), m_primitives.size());
+        m_primitives.append(getPrimitive(
+            wheelSpeedAdjustmentFactors,
+            it.value().first,
+            it.value().second));
+        QStringList wheelSpeeds;
+        for (int i = 0; i < m_wheels.size(); i += 1) {
+            wheelSpeeds.append(m_wheelNames.at(i) + " " + QString::number(
+                m_primitives.last().wheelSpeeds.at(i).getRevolutionsPerMinute()));
+        }
+        qInfo().noquote().nospace()
+            << "Movement primitive " << it.key() << ": "
+            << wheelSpeeds.join(", ") << " rpm, "
+            << m_primitives.last().forwardSpeed.getMetersPerSecond() << " m/s, "
+            << m_primitives.last().turnRate.getDegreesPerSecond() << " deg/s.";
+    }
 
-    // Initialize the collision polygon; this is technically not correct since
-    // we should be using union, not convexHull, but it's a good approximation
+    // Initialize the collision shape, which is exactly the union of the body,
+    // wheels, and sensors, decomposed into convex parts
     QVector<Polygon> polygons;
     polygons.push_back(m_initialBodyPolygon);
     for (const Wheel& wheel : m_wheels) {
@@ -68,7 +156,7 @@ bool Mouse::reload(const QString& mouseFile) {
     for (const Sensor& sensor : m_sensors) {
         polygons.push_back(sensor.getInitialPolygon());
     }
-    m_initialCollisionPolygon = GeometryUtilities::convexHull(polygons);
+    m_collisionShape = CollisionShape(polygons);
 
     // Initialize the center of mass polygon
     m_initialCenterOfMassPolygon = GeometryUtilities::createCirclePolygon(
@@ -79,15 +167,14 @@ bool Mouse::reload(const QString& mouseFile) {
 
     // Force triangulation of the drawable polygons, thus ensuring
     // that we only triangulate once, at the beginning of execution
-    m_initialBodyPolygon.getTriangles();
-    m_initialCollisionPolygon.getTriangles();
-    m_initialCenterOfMassPolygon.getTriangles();
+    m_initialBodyPolygon.getTriangulation();
+    m_initialCenterOfMassPolygon.getTriangulation();
     for (const Wheel& wheel : m_wheels) {
-        wheel.getInitialPolygon().getTriangles();
+        wheel.getInitialPolygon().getTriangulation();
     }
     for (const Sensor& sensor : m_sensors) {
-        sensor.getInitialPolygon().getTriangles();
-        sensor.getInitialViewPolygon().getTriangles();
+        sensor.getInitialPolygon().getTriangulation();
+        sensor.getInitialViewPolygon().getTriangulation();
     }
 
     // Lastly, keep track of the mouse file we just successfully loaded
@@ -116,6 +203,9 @@ void Mouse::reset() {
     );
     m_startedDirection = m_startingDirection;
     m_crashed = false;
+    m_mutex.lock();
+    m_updateCount = 0;
+    m_mutex.unlock();
 }
 
 void Mouse::teleport(const Coordinate& translation, const Angle& rotation) {
@@ -135,6 +225,10 @@ const Coordinate& Mouse::getInitialTranslation() const {
     return m_initialTranslation;
 }
 
+const Angle& Mouse::getInitialRotation() const {
+    return m_initialRotation;
+}
+
 const Coordinate& Mouse::getCurrentTranslation() const {
     return m_currentTranslation;
 }
@@ -170,7 +264,19 @@ Direction Mouse::getCurrentDiscretizedRotation() const {
     }
 }
 
-Polygon Mouse::getCurrentBodyPolygon(
+AffineTransform Mouse::getCurrentTransform(
+        const Coordinate& currentTranslation,
+        const Angle& currentRotation) const {
+    // Move the initial translation to the current translation, and then
+    // rotate about the current translation
+    return AffineTransform::Translation(
+        currentTranslation - getInitialTranslation()).then(
+        AffineTransform::Rotation(
+            currentRotation - m_initialRotation,
+            currentTranslation));
+}
+
+TransformedPolygon Mouse::getCurrentBodyPolygon(
         const Coordinate& currentTranslation,
         const Angle& currentRotation) const {
     return getCurrentPolygon(
@@ -179,16 +285,27 @@ Polygon Mouse::getCurrentBodyPolygon(
         currentRotation);
 }
 
-Polygon Mouse::getCurrentCollisionPolygon(
+QVector<TransformedPolygon> Mouse::getCurrentCollisionPolygons(
         const Coordinate& currentTranslation,
         const Angle& currentRotation) const {
-    return getCurrentPolygon(
-        m_initialCollisionPolygon,
-        currentTranslation,
-        currentRotation);
+    AffineTransform transform =
+        getCurrentTransform(currentTranslation, currentRotation);
+    QVector<TransformedPolygon> polygons;
+    for (const Polygon& part : m_collisionShape.getParts()) {
+        polygons.push_back(part.transformed(transform));
+    }
+    return polygons;
+}
+
+bool Mouse::isColliding(
+        const Coordinate& currentTranslation,
+        const Angle& currentRotation) const {
+    return m_collisionShape.collides(
+        getCurrentTransform(currentTranslation, currentRotation),
+        *m_maze);
 }
 
-Polygon Mouse::getCurrentCenterOfMassPolygon(
+TransformedPolygon Mouse::getCurrentCenterOfMassPolygon(
         const Coordinate& currentTranslation,
         const Angle& currentRotation) const {
     return getCurrentPolygon(
@@ -197,30 +314,26 @@ Polygon Mouse::getCurrentCenterOfMassPolygon(
         currentRotation);
 }
 
-QVector<Polygon> Mouse::getCurrentWheelPolygons(
+QVector<TransformedPolygon> Mouse::getCurrentWheelPolygons(
         const Coordinate& currentTranslation,
         const Angle& currentRotation) const {
-    QVector<Polygon> polygons;
+    AffineTransform transform =
+        getCurrentTransform(currentTranslation, currentRotation);
+    QVector<TransformedPolygon> polygons;
     for (const Wheel& wheel: m_wheels) {
-        polygons.push_back(getCurrentPolygon(
-            wheel.getInitialPolygon(),
-            currentTranslation,
-            currentRotation
-        ));
+        polygons.push_back(wheel.getInitialPolygon().transformed(transform));
     }
     return polygons;
 }
 
-QVector<Polygon> Mouse::getCurrentSensorPolygons(
+QVector<TransformedPolygon> Mouse::getCurrentSensorPolygons(
         const Coordinate& currentTranslation,
         const Angle& currentRotation) const {
-    QVector<Polygon> polygons;
+    AffineTransform transform =
+        getCurrentTransform(currentTranslation, currentRotation);
+    QVector<TransformedPolygon> polygons;
     for (const Sensor& sensor : m_sensors) {
-        polygons.push_back(getCurrentPolygon(
-            sensor.getInitialPolygon(),
-            currentTranslation,
-            currentRotation
-        ));
+        polygons.push_back(sensor.getInitialPolygon().transformed(transform));
     }
     return polygons;
 }
@@ -252,50 +365,57 @@ void Mouse::update(const Duration& elapsed) {
         return;
     }
 
-    Speed sumDx;
-    Speed sumDy;
-    AngularVelocity sumDr;
+    WheelEffect start;
+    WheelEffect end;
 
     m_mutex.lock();
 
-    // Iterate over all of the wheels
-    QMap<QString, Wheel>::iterator it;
-    for (it = m_wheels.begin(); it != m_wheels.end(); it += 1) {
-        WheelEffect effect = it.value().update(elapsed);
-
-        // The effect of the forward component
-        sumDx += effect.forwardEffect * getCurrentRotation().getCos();
-        sumDy += effect.forwardEffect * getCurrentRotation().getSin();
-
-        // The effect of the sideways component
-        sumDx += effect.sidewaysEffect * getCurrentRotation().getSin();
-        sumDy += effect.sidewaysEffect * getCurrentRotation().getCos() * -1;
-
-        // The effect of the rotation component
-        sumDr += effect.turnEffect;
+    m_updateCount += 1;
+
+    // Iterate over all of the wheels, letting the motors bring them toward
+    // their target speeds
+    for (int i = 0; i < m_wheels.size(); i += 1) {
+        QPair<WheelEffect, WheelEffect> effects = m_wheels[i].update(elapsed);
+        start.forwardEffect += effects.first.forwardEffect;
+        start.sidewaysEffect += effects.first.sidewaysEffect;
+        start.turnEffect += effects.first.turnEffect;
+        end.forwardEffect += effects.second.forwardEffect;
+        end.sidewaysEffect += effects.second.sidewaysEffect;
+        end.turnEffect += effects.second.turnEffect;
     }
 
     m_mutex.unlock();
 
-    Speed aveDx = sumDx / m_wheels.size();
-    Speed aveDy = sumDy / m_wheels.size();
-    AngularVelocity aveDr = sumDr / m_wheels.size();
-
-    m_currentGyro = aveDr;
-    m_currentRotation += aveDr * elapsed;
-    m_currentTranslation += Coordinate::Cartesian(aveDx * elapsed, aveDy * elapsed);
+    // The velocity of the mouse, in its own frame of reference, at the start
+    // and end of the step, which is the average of the effects of the wheels
+    start.forwardEffect = start.forwardEffect / m_wheels.size();
+    start.sidewaysEffect = start.sidewaysEffect / m_wheels.size();
+    start.turnEffect = start.turnEffect / m_wheels.size();
+    end.forwardEffect = end.forwardEffect / m_wheels.size();
+    end.sidewaysEffect = end.sidewaysEffect / m_wheels.size();
+    end.turnEffect = end.turnEffect / m_wheels.size();
+
+    QPair<Coordinate, Angle> pose = PoseIntegrator::integrate(
+        m_integratorType,
+        m_currentTranslation,
+        Rotation(m_currentRotation),
+        start,
+        end,
+        elapsed);
+
+    m_currentGyro = end.turnEffect;
+    m_currentTranslation = pose.first;
+    m_currentRotation = pose.second;
 
     // Update all of the sensor readings
     /* TODO: MACK
-    QMutableMapIterator<QString, Sensor> sensorIterator(m_sensors);
-    while (sensorIterator.hasNext()) {
-        auto pair = sensorIterator.next();
+    for (int i = 0; i < m_sensors.size(); i += 1) {
         QPair<Coordinate, Angle> translationAndRotation =
             getCurrentSensorPositionAndDirection(
-                pair.value(),
+                m_sensors.at(i),
                 m_currentTranslation,
                 m_currentRotation);
-        pair.value().updateReading(
+        m_sensors[i].updateReading(
             translationAndRotation.first,
             translationAndRotation.second,
             *m_maze);
@@ -303,129 +423,191 @@ void Mouse::update(const Duration& elapsed) {
     */
 }
 
-bool Mouse::hasWheel(const QString& name) const {
-    return m_wheels.contains(name);
+int Mouse::getWheelHandle(const QString& name) const {
+    return m_wheelHandles.value(name, -1);
+}
+
+int Mouse::getWheelCount() const {
+    return m_wheels.size();
+}
+
+const QString& Mouse::getWheelName(int wheel) const {
+    ASSERT_TR(hasWheel(wheel));
+    return m_wheelNames.at(wheel);
 }
 
-const AngularVelocity& Mouse::getWheelMaxSpeed(const QString& name) {
-    ASSERT_TR(m_wheels.contains(name));
-    return m_wheels[name].getMaximumSpeed();
+bool Mouse::hasWheel(int wheel) const {
+    return 0 <= wheel && wheel < m_wheels.size();
 }
 
-void Mouse::setWheelSpeeds(const QMap<QString, AngularVelocity>& wheelSpeeds) {
+const AngularVelocity& Mouse::getWheelMaxSpeed(int wheel) const {
+    ASSERT_TR(hasWheel(wheel));
+    return m_wheels.at(wheel).getMaximumSpeed();
+}
+
+void Mouse::setWheelSpeed(int wheel, const AngularVelocity& speed) {
+    ASSERT_TR(hasWheel(wheel));
+    m_mutex.lock();
+    m_wheels[wheel].setSpeed(speed);
+    m_mutex.unlock();
+}
+
+void Mouse::setWheelSpeeds(const QVector<AngularVelocity>& wheelSpeeds) {
+    ASSERT_EQ(wheelSpeeds.size(), m_wheels.size());
     m_mutex.lock();
-    QMap<QString, AngularVelocity>::const_iterator it;
-    for (it = wheelSpeeds.constBegin(); it != wheelSpeeds.constEnd(); it += 1) {
-        ASSERT_TR(m_wheels.contains(it.key()));
-        m_wheels[it.key()].setSpeed(it.value());
+    for (int i = 0; i < m_wheels.size(); i += 1) {
+        m_wheels[i].setSpeed(wheelSpeeds.at(i));
     }
     m_mutex.unlock();
 }
 
-void Mouse::setWheelSpeedsForMoveForward(double fractionOfMaxSpeed) {
-    setWheelSpeedsForMovement(fractionOfMaxSpeed, 1.0, 0.0);
+void Mouse::setWheelSpeedsForPrimitive(MovementPrimitive primitive, double fractionOfMaxSpeed) {
+    const QVector<AngularVelocity>& wheelSpeeds = getPrimitiveWheelSpeeds(primitive);
+    m_mutex.lock();
+    for (int i = 0; i < m_wheels.size(); i += 1) {
+        m_wheels[i].setSpeed(wheelSpeeds.at(i) * fractionOfMaxSpeed);
+    }
+    m_mutex.unlock();
 }
 
-void Mouse::setWheelSpeedsForCurveLeft(double fractionOfMaxSpeed, const Distance& radius) {
-    QPair<double, double> curveTurnFactors =
-        m_curveTurnFactorCalculator.getCurveTurnFactors(radius);
-    setWheelSpeedsForMovement(
-        fractionOfMaxSpeed,
-        curveTurnFactors.first,
-        curveTurnFactors.second);
+void Mouse::stopAllWheels() {
+    m_mutex.lock();
+    for (int i = 0; i < m_wheels.size(); i += 1) {
+        m_wheels[i].stop();
+    }
+    m_mutex.unlock();
 }
 
-void Mouse::setWheelSpeedsForCurveRight(double fractionOfMaxSpeed, const Distance& radius) {
-    QPair<double, double> curveTurnFactors =
-        m_curveTurnFactorCalculator.getCurveTurnFactors(radius);
-    setWheelSpeedsForMovement(
-        fractionOfMaxSpeed,
-        curveTurnFactors.first,
-        -1 * curveTurnFactors.second);
+const QVector<AngularVelocity>& Mouse::getPrimitiveWheelSpeeds(MovementPrimitive primitive) const {
+    return m_primitives.at(static_cast<int>(primitive)).wheelSpeeds;
 }
 
-void Mouse::stopAllWheels() {
-    QMap<QString, AngularVelocity> wheelSpeeds;
-    QMap<QString, Wheel>::const_iterator it;
-    for (it = m_wheels.constBegin(); it != m_wheels.constEnd(); it += 1) {
-        wheelSpeeds.insert(it.key(), AngularVelocity::RadiansPerSecond(0));
-    }
-    setWheelSpeeds(wheelSpeeds);
+QPair<Speed, AngularVelocity> Mouse::getPrimitiveVelocity(
+        MovementPrimitive primitive,
+        double fractionOfMaxSpeed) const {
+    const Primitive& precomputed = m_primitives.at(static_cast<int>(primitive));
+    return {
+        precomputed.forwardSpeed * fractionOfMaxSpeed,
+        precomputed.turnRate * fractionOfMaxSpeed,
+    };
 }
 
-EncoderType Mouse::getWheelEncoderType(const QString& name) const {
-    ASSERT_TR(hasWheel(name));
-    return m_wheels.value(name).getEncoderType();
+EncoderType Mouse::getWheelEncoderType(int wheel) const {
+    ASSERT_TR(hasWheel(wheel));
+    return m_wheels.at(wheel).getEncoderType();
 }
 
-double Mouse::getWheelEncoderTicksPerRevolution(const QString& name) const {
-    ASSERT_TR(hasWheel(name));
-    return m_wheels.value(name).getEncoderTicksPerRevolution();
+double Mouse::getWheelEncoderTicksPerRevolution(int wheel) const {
+    ASSERT_TR(hasWheel(wheel));
+    return m_wheels.at(wheel).getEncoderTicksPerRevolution();
 }
 
-int Mouse::readWheelAbsoluteEncoder(const QString& name) const {
-    ASSERT_TR(hasWheel(name));
+int Mouse::readWheelAbsoluteEncoder(int wheel) const {
+    ASSERT_TR(hasWheel(wheel));
     m_mutex.lock();
-    int encoderReading = m_wheels.value(name).readAbsoluteEncoder();
+    int encoderReading = m_wheels.at(wheel).readAbsoluteEncoder();
+    quint64 sample = m_updateCount;
     m_mutex.unlock();
-    return encoderReading;
+    return applyEncoderNoise(wheel, encoderReading, sample);
 }
 
-int Mouse::readWheelRelativeEncoder(const QString& name) const {
-    ASSERT_TR(hasWheel(name));
+int Mouse::readWheelRelativeEncoder(int wheel) const {
+    ASSERT_TR(hasWheel(wheel));
     m_mutex.lock();
-    int encoderReading = m_wheels.value(name).readRelativeEncoder();
+    int encoderReading = m_wheels.at(wheel).readRelativeEncoder();
+    quint64 sample = m_updateCount;
     m_mutex.unlock();
-    return encoderReading;
+    return applyEncoderNoise(wheel, encoderReading, sample);
 }
 
-void Mouse::resetWheelRelativeEncoder(const QString& name) {
-    ASSERT_TR(hasWheel(name));
+void Mouse::resetWheelRelativeEncoder(int wheel) {
+    ASSERT_TR(hasWheel(wheel));
     m_mutex.lock();
-    m_wheels[name].resetRelativeEncoder();
+    m_wheels[wheel].resetRelativeEncoder();
     m_mutex.unlock();
 }
 
-bool Mouse::hasSensor(const QString& name) const {
-    return m_sensors.contains(name);
+int Mouse::getSensorHandle(const QString& name) const {
+    return m_sensorHandles.value(name, -1);
+}
+
+int Mouse::getSensorCount() const {
+    return m_sensors.size();
 }
 
-double Mouse::readSensor(const QString& name) const {
-    ASSERT_TR(hasSensor(name));
-    return m_sensors.value(name).read();
+const QString& Mouse::getSensorName(int sensor) const {
+    ASSERT_TR(hasSensor(sensor));
+    return m_sensorNames.at(sensor);
 }
 
-const AngularVelocity& Mouse::readGyro() const {
-    return m_currentGyro;
+bool Mouse::hasSensor(int sensor) const {
+    return 0 <= sensor && sensor < m_sensors.size();
 }
 
-Polygon Mouse::getCurrentPolygon(
+double Mouse::readSensor(int sensor) const {
+    ASSERT_TR(hasSensor(sensor));
+
+    // With sensor tables, the reading for the current pose is just a lookup;
+    // until they're built, we cast the rays at the current pose instead
+    QPair<Coordinate, Angle> positionAndDirection =
+        getCurrentSensorPositionAndDirection(
+            m_sensors.at(sensor),
+            m_currentTranslation,
+            m_currentRotation);
+    double reading;
+    if (m_sensorTables->ready) {
+        reading = m_sensorTables->tables.at(sensor).lookup(
+            positionAndDirection.first,
+            positionAndDirection.second);
+    }
+    else {
+        reading = m_sensors.at(sensor).getReading(
+            positionAndDirection.first,
+            positionAndDirection.second,
+            *m_maze);
+    }
+
+    const Noise& noise = m_sensors.at(sensor).getNoise();
+    if (noise.isNone()) {
+        return reading;
+    }
+    reading = noise.apply(reading, SENSOR_NOISE_STREAM + sensor, getUpdateCount());
+    return std::min(std::max(reading, 0.0), 1.0);
+}
+
+AngularVelocity Mouse::readGyro() const {
+    if (m_gyroNoise.isNone()) {
+        return m_currentGyro;
+    }
+    return AngularVelocity::DegreesPerSecond(m_gyroNoise.apply(
+        m_currentGyro.getDegreesPerSecond(),
+        GYRO_NOISE_STREAM,
+        getUpdateCount()));
+}
+
+TransformedPolygon Mouse::getCurrentPolygon(
         const Polygon& initialPolygon,
         const Coordinate& currentTranslation,
         const Angle& currentRotation) const {
-    return initialPolygon
-        .translate(currentTranslation - getInitialTranslation())
-        .rotateAroundPoint(currentRotation - m_initialRotation, currentTranslation);
+    return initialPolygon.transformed(
+        getCurrentTransform(currentTranslation, currentRotation));
 }
 
 QPair<Coordinate, Angle> Mouse::getCurrentSensorPositionAndDirection(
         const Sensor& sensor,
         const Coordinate& currentTranslation,
         const Angle& currentRotation) const {
-    Coordinate translationDelta = currentTranslation - getInitialTranslation();
-    Angle rotationDelta = currentRotation - m_initialRotation;
     return {
-        GeometryUtilities::rotateVertexAroundPoint(
-            GeometryUtilities::translateVertex(
-                sensor.getInitialPosition(),
-                translationDelta),
-            rotationDelta,
-            currentTranslation),
-        sensor.getInitialDirection() + rotationDelta
+        getCurrentTransform(currentTranslation, currentRotation).map(
+            sensor.getInitialPosition()),
+        sensor.getInitialDirection() + (currentRotation - m_initialRotation)
     };
 }
 
-void Mouse::setWheelSpeedsForMovement(double fractionOfMaxSpeed, double forwardFactor, double turnFactor) {
+Mouse::Primitive Mouse::getPrimitive(
+        const QVector<QPair<double, double>>& wheelSpeedAdjustmentFactors,
+        double forwardFactor,
+        double turnFactor) const {
 
     // We can think about setting the wheels speeds for particular movements as
     // a linear combination of the forward movement and the turn movement. For
@@ -448,29 +630,47 @@ void Mouse::setWheelSpeedsForMovement(double fractionOfMaxSpeed, double forwardF
     ASSERT_LE(0.0, normalizedFactorMagnitude);
     ASSERT_LE(normalizedFactorMagnitude, 1.0);
 
-    // Now set the wheel speeds based on the normalized factors
-    QMap<QString, AngularVelocity> wheelSpeeds;
-    QMap<QString, Wheel>::const_iterator it;
-    for (it = m_wheels.constBegin(); it != m_wheels.constEnd(); it += 1) {
-        ASSERT_TR(m_wheelSpeedAdjustmentFactors.contains(it.key()));
-        QPair<double, double> adjustmentFactors = m_wheelSpeedAdjustmentFactors.value(it.key());
-        wheelSpeeds.insert(
-            it.key(),
-            (
-                it.value().getMaximumSpeed() *
-                fractionOfMaxSpeed *
-                (
-                    normalizedForwardFactor * adjustmentFactors.first +
-                    normalizedTurnFactor * adjustmentFactors.second
-                )
-            )
+    // Now compute the wheel speeds based on the normalized factors, and, since
+    // wheel effects are linear in the wheel speed, each wheel's contribution
+    // to the velocity, as its maximum effect scaled by its fraction
+    Primitive primitive;
+    ASSERT_EQ(wheelSpeedAdjustmentFactors.size(), m_wheels.size());
+    for (int i = 0; i < m_wheels.size(); i += 1) {
+        const QPair<double, double>& adjustmentFactors = wheelSpeedAdjustmentFactors.at(i);
+        double fraction = (
+            normalizedForwardFactor * adjustmentFactors.first +
+            normalizedTurnFactor * adjustmentFactors.second
         );
+        primitive.wheelSpeeds.append(m_wheels.at(i).getMaximumSpeed() * fraction);
+        WheelEffect maximumEffect = m_wheels.at(i).getMaximumEffect();
+        primitive.forwardSpeed += maximumEffect.forwardEffect * fraction;
+        primitive.turnRate += maximumEffect.turnEffect * fraction;
+    }
+    if (!m_wheels.isEmpty()) {
+        primitive.forwardSpeed = primitive.forwardSpeed / m_wheels.size();
+        primitive.turnRate = primitive.turnRate / m_wheels.size();
+    }
+    return primitive;
+}
+
+quint64 Mouse::getUpdateCount() const {
+    m_mutex.lock();
+    quint64 updateCount = m_updateCount;
+    m_mutex.unlock();
+    return updateCount;
+}
+
+int Mouse::applyEncoderNoise(int wheel, int reading, quint64 sample) const {
+    const Noise& noise = m_wheels.at(wheel).getEncoderNoise();
+    if (noise.isNone()) {
+        return reading;
     }
-    setWheelSpeeds(wheelSpeeds);
+    return static_cast<int>(std::round(
+        noise.apply(reading, ENCODER_NOISE_STREAM + wheel, sample)));
 }
 
-QMap<QString, QPair<double, double>> Mouse::getWheelSpeedAdjustmentFactors(
-        const QMap<QString, Wheel>& wheels) const {
+QVector<QPair<double, double>> Mouse::getWheelSpeedAdjustmentFactors(
+        const QVector<Wheel>& wheels) const {
 
     // Right now, the heueristic that we're using is that if a wheel greatly
     // contributes to moving forward or turning, then its adjustment factors
@@ -482,12 +682,10 @@ QMap<QString, QPair<double, double>> Mouse::getWheelSpeedAdjustmentFactors(
     // velocity magnitude into account, but I've done so here.
 
     // First, construct the rates of change pairs
-    QMap<QString, QPair<Speed, AngularVelocity>> ratesOfChangePairs;
-    QMap<QString, Wheel>::const_iterator it1;
-    for (it1 = wheels.constBegin(); it1 != wheels.constEnd(); it1 += 1) {
-        WheelEffect effect = it1.value().getMaximumEffect();
-        ratesOfChangePairs.insert(
-            it1.key(),
+    QVector<QPair<Speed, AngularVelocity>> ratesOfChangePairs;
+    for (const Wheel& wheel : wheels) {
+        WheelEffect effect = wheel.getMaximumEffect();
+        ratesOfChangePairs.append(
             {
                 effect.forwardEffect,
                 effect.turnEffect,
@@ -498,12 +696,11 @@ QMap<QString, QPair<double, double>> Mouse::getWheelSpeedAdjustmentFactors(
     // Then determine the largest magnitude
     Speed maxForwardRateOfChangeMagnitude;
     AngularVelocity maxRadialRateOfChangeMagnitude;
-    QMap<QString, QPair<Speed, AngularVelocity>>::const_iterator it2;
-    for (it2 = ratesOfChangePairs.constBegin(); it2 != ratesOfChangePairs.constEnd(); it2 += 1) {
+    for (const QPair<Speed, AngularVelocity>& pair : ratesOfChangePairs) {
         Speed forwardRateOfChangeMagnitude = Speed::MetersPerSecond(
-            std::abs(it2.value().first.getMetersPerSecond()));
+            std::abs(pair.first.getMetersPerSecond()));
         AngularVelocity radialRateOfChangeMagnitude = AngularVelocity::RadiansPerSecond(
-            std::abs(it2.value().second.getRadiansPerSecond()));
+            std::abs(pair.second.getRadiansPerSecond()));
         if (maxForwardRateOfChangeMagnitude < forwardRateOfChangeMagnitude) {
             maxForwardRateOfChangeMagnitude = forwardRateOfChangeMagnitude;
         }
@@ -513,20 +710,18 @@ QMap<QString, QPair<double, double>> Mouse::getWheelSpeedAdjustmentFactors(
     }
 
     // Then divide by the largest magnitude, ensuring values in [-1.0, 1.0]
-    QMap<QString, QPair<double, double>> adjustmentFactors;
-    QMap<QString, QPair<Speed, AngularVelocity>>::const_iterator it3;
-    for (it3 = ratesOfChangePairs.constBegin(); it3 != ratesOfChangePairs.constEnd(); it3 += 1) {
-        double normalizedForwardContribution = it3.value().first / maxForwardRateOfChangeMagnitude;
+    QVector<QPair<double, double>> adjustmentFactors;
+    for (const QPair<Speed, AngularVelocity>& pair : ratesOfChangePairs) {
+        double normalizedForwardContribution = pair.first / maxForwardRateOfChangeMagnitude;
         double normalizedRadialContribution = (
-            it3.value().second.getRadiansPerSecond() /
+            pair.second.getRadiansPerSecond() /
             maxRadialRateOfChangeMagnitude.getRadiansPerSecond()
         );
         ASSERT_LE(-1.0, normalizedForwardContribution);
         ASSERT_LE(-1.0, normalizedRadialContribution);
         ASSERT_LE(normalizedForwardContribution, 1.0);
         ASSERT_LE(normalizedRadialContribution, 1.0);
-        adjustmentFactors.insert(
-            it3.key(),
+        adjustmentFactors.append(
             {
                 normalizedForwardContribution,
                 normalizedRadialContribution
@@ -6,15 +6,24 @@
 #include <QString>
 #include <QVector>
 
+#include <atomic>
+#include <memory>
+
 #include "units/AngularVelocity.h"
 #include "units/Coordinate.h"
+#include "units/Speed.h"
 
-#include "CurveTurnFactorCalculator.h"
+#include "CollisionShape.h"
 #include "Direction.h"
 #include "EncoderType.h"
+#include "IntegratorType.h"
 #include "Maze.h"
+#include "MovementPrimitive.h"
+#include "Noise.h"
 #include "Polygon.h"
 #include "Sensor.h"
+#include "SensorTable.h"
+#include "TransformedPolygon.h"
 #include "Wheel.h"
 
 namespace mms {
@@ -49,8 +58,10 @@ public:
     // Set the direction that the mouse should face whenever reset
     void setStartingDirection(Direction startingDirection);
 
-    // Gets the initial translation of the mouse
+    // Gets the initial translation and rotation of the mouse, i.e., the pose
+    // at which the initial polygons were constructed
     const Coordinate& getInitialTranslation() const;
+    const Angle& getInitialRotation() const;
 
     // Gets the current translation and rotation of the mouse
     const Coordinate& getCurrentTranslation() const;
@@ -60,29 +71,41 @@ public:
     QPair<int, int> getCurrentDiscretizedTranslation() const;
     Direction getCurrentDiscretizedRotation() const;
 
+    // Retrieves the transformation from the initial translation and rotation
+    // of the mouse to the given translation and rotation
+    AffineTransform getCurrentTransform(
+        const Coordinate& currentTranslation,
+        const Angle& currentRotation) const;
+
     // Retrieves the polygon of just the body of the mouse
-    Polygon getCurrentBodyPolygon(
+    TransformedPolygon getCurrentBodyPolygon(
         const Coordinate& currentTranslation,
         const Angle& currentRotation) const;
 
-    // Retrieves the polygon comprised of all parts
+    // Retrieves the convex parts of the union of all parts
     // of the mouse that could collide with walls
-    Polygon getCurrentCollisionPolygon(
+    QVector<TransformedPolygon> getCurrentCollisionPolygons(
+        const Coordinate& currentTranslation,
+        const Angle& currentRotation) const;
+
+    // Whether or not the mouse, at the given translation
+    // and rotation, overlaps any walls or posts of the maze
+    bool isColliding(
         const Coordinate& currentTranslation,
         const Angle& currentRotation) const;
 
     // Retrieves the center of mass polygon of the mouse
-    Polygon getCurrentCenterOfMassPolygon(
+    TransformedPolygon getCurrentCenterOfMassPolygon(
         const Coordinate& currentTranslation,
         const Angle& currentRotation) const;
 
     // Retrieves the polygons of the wheels of the robot
-    QVector<Polygon> getCurrentWheelPolygons(
+    QVector<TransformedPolygon> getCurrentWheelPolygons(
         const Coordinate& currentTranslation,
         const Angle& currentRotation) const;
 
     // Retrieves the polygons of the sensors of the robot
-    QVector<Polygon> getCurrentSensorPolygons(
+    QVector<TransformedPolygon> getCurrentSensorPolygons(
         const Coordinate& currentTranslation,
         const Angle& currentRotation) const;
 
@@ -95,48 +118,80 @@ public:
     // based on how much simulation time has elapsed
     void update(const Duration& elapsed);
 
-    // Returns whether or not the mouse has a wheel by a particular name
-    bool hasWheel(const QString& name) const;
+    // The wheels and sensors are referred to by dense integer handles, in
+    // [0, count), which are assigned (in order of name) when the mouse is
+    // reloaded; names are resolved to handles only at the boundary
+
+    // Returns the handle of the wheel by a particular name, or -1 if none
+    int getWheelHandle(const QString& name) const;
+    int getWheelCount() const;
+    const QString& getWheelName(int wheel) const;
 
-    // Returns the magnitde of the max angular velocity of the wheel;
-    // intentionally not const to avoid making copies of Wheel objects.
-    const AngularVelocity& getWheelMaxSpeed(const QString& name);
+    // Returns whether or not the mouse has a wheel with a particular handle
+    bool hasWheel(int wheel) const;
+
+    // Returns the magnitde of the max angular velocity of the wheel
+    const AngularVelocity& getWheelMaxSpeed(int wheel) const;
 
     // An atomic interface for setting the wheel speeds
-    void setWheelSpeeds(const QMap<QString, AngularVelocity>& wheelSpeeds);
+    void setWheelSpeed(int wheel, const AngularVelocity& speed);
+    void setWheelSpeeds(const QVector<AngularVelocity>& wheelSpeeds);
 
     // Helper methods for setting many wheel speeds at once, without having to
-    // know the names of each of the wheels
-    void setWheelSpeedsForMoveForward(double fractionOfMaxSpeed);
-    void setWheelSpeedsForCurveLeft(double fractionOfMaxSpeed, const Distance& radius);
-    void setWheelSpeedsForCurveRight(double fractionOfMaxSpeed, const Distance& radius);
+    // know the handles of each of the wheels; note that stopAllWheels() stops
+    // the wheels immediately, regardless of their motors. The discrete
+    // movements stop the wheels this way at the end of each move, and then
+    // snap to the exact destination, so the motor model only really applies
+    // to the continuous interface: a discrete move pays for its acceleration
+    // ramp, but never for a deceleration.
+    void setWheelSpeedsForPrimitive(MovementPrimitive primitive, double fractionOfMaxSpeed);
     void stopAllWheels();
 
-    // Returns the encoder type of the wheel given by name
-    EncoderType getWheelEncoderType(const QString& name) const;
+    // The wheel speeds for each of the movement primitives are precomputed
+    // when the mouse is reloaded, at the max speed. Since the effects of the
+    // wheels are linear in their speeds, the speeds for any other fraction of
+    // the max speed are just scaled, so that setting them is just a lookup.
+    // These expose the table, e.g., for inspecting the (not necessarily
+    // obvious) speeds chosen for mice with unusual wheel configurations.
+
+    // The wheel speeds, indexed by handle, at the max speed
+    const QVector<AngularVelocity>& getPrimitiveWheelSpeeds(MovementPrimitive primitive) const;
+
+    // The forward speed and rotation rate of the mouse, averaged over its
+    // wheels as in update(), when its wheel speeds are set for the primitive
+    QPair<Speed, AngularVelocity> getPrimitiveVelocity(
+        MovementPrimitive primitive,
+        double fractionOfMaxSpeed) const;
+
+    // Returns the encoder type of the wheel
+    EncoderType getWheelEncoderType(int wheel) const;
 
-    // Returns the number of encoder ticks per revolution
-    // for a particular wheel given by name
-    double getWheelEncoderTicksPerRevolution(const QString& name) const;
+    // Returns the number of encoder ticks per revolution for the wheel
+    double getWheelEncoderTicksPerRevolution(int wheel) const;
 
-    // Returns the reading of the encoder of the wheel given by name
-    int readWheelAbsoluteEncoder(const QString& name) const;
+    // Returns the reading of the absolute encoder of the wheel
+    int readWheelAbsoluteEncoder(int wheel) const;
 
-    // Returns the reading of the encoder of the wheel given by name
-    int readWheelRelativeEncoder(const QString& name) const;
+    // Returns the reading of the relative encoder of the wheel
+    int readWheelRelativeEncoder(int wheel) const;
 
     // Sets the value of the relative encoder to zero
-    void resetWheelRelativeEncoder(const QString& name);
+    void resetWheelRelativeEncoder(int wheel);
 
-    // Returns whether or not the mouse has a sensor by a particular name
-    bool hasSensor(const QString& name) const;
+    // Returns the handle of the sensor by a particular name, or -1 if none
+    int getSensorHandle(const QString& name) const;
+    int getSensorCount() const;
+    const QString& getSensorName(int sensor) const;
+
+    // Returns whether or not the mouse has a sensor with a particular handle
+    bool hasSensor(int sensor) const;
 
     // Read a sensor, and returns a value from 0.0
     // (completely free) to 1.0 (completely blocked)
-    double readSensor(const QString& name) const;
+    double readSensor(int sensor) const;
 
     // Returns the value of the gyroscope
-    const AngularVelocity& readGyro() const;
+    AngularVelocity readGyro() const;
 
 private:
 
@@ -149,6 +204,22 @@ private:
     // Whether or not the mouse crashed
     bool m_crashed;
 
+    // The number of updates since the most recent reload or reset, which is
+    // the sample number of the noise of the sensors, encoders, and gyro, so
+    // that the noise depends only on the seed and the sim time
+    quint64 m_updateCount;
+    quint64 getUpdateCount() const;
+
+    // The streams of noise, one per sensor, encoder, and the gyro
+    static const quint32 SENSOR_NOISE_STREAM = 0x00000;
+    static const quint32 ENCODER_NOISE_STREAM = 0x10000;
+    static const quint32 GYRO_NOISE_STREAM = 0x20000;
+    Noise m_gyroNoise;
+    int applyEncoderNoise(int wheel, int reading, quint64 sample) const;
+
+    // How the pose of the mouse is advanced in update()
+    IntegratorType m_integratorType;
+
     // The direction that the mouse did and should face,
     // respectively, at the most recent and next reset
     Direction m_startedDirection;
@@ -160,10 +231,27 @@ private:
 
     // The parts of the mouse, as when positioned at m_initialTranslation and m_initialRotation
     Polygon m_initialBodyPolygon; // The polygon of strictly the body of the mouse
-    Polygon m_initialCollisionPolygon; // The polygon containing all collidable parts of the mouse
+    CollisionShape m_collisionShape; // The union of all collidable parts of the mouse
     Polygon m_initialCenterOfMassPolygon; // The polygon overlaying the center of mass of the mouse
-    QMap<QString, Wheel> m_wheels; // The wheels of the mouse
-    QMap<QString, Sensor> m_sensors; // The sensors on the mouse
+    QVector<Wheel> m_wheels; // The wheels of the mouse, indexed by handle
+    QVector<Sensor> m_sensors; // The sensors on the mouse, indexed by handle
+
+    // The names of the wheels and sensors, and their inverses
+    QVector<QString> m_wheelNames;
+    QVector<QString> m_sensorNames;
+    QMap<QString, int> m_wheelHandles;
+    QMap<QString, int> m_sensorHandles;
+
+    // Precomputed readings of the sensors, indexed by handle (see
+    // SensorTableCache). The tables are built on the global thread pool, so
+    // that loading a mouse doesn't block the GUI; until they're ready, if
+    // ever, the sensors are read by ray casting instead. The tables are only
+    // written before ready is set, and are never written again after that.
+    struct SensorTables {
+        std::atomic<bool> ready {false};
+        QVector<SensorTable> tables;
+    };
+    std::shared_ptr<SensorTables> m_sensorTables;
 
     // The fractions of a each wheel's max speed that cause the mouse to
     // perform the move forward and turn movements, respectively, as optimally
@@ -172,14 +260,16 @@ private:
     // moving sideways, and/or turn without moving forward or sideways.
     // Also note that the fractions are in [-1.0, 1.0], so that the max wheel
     // speed is never exceeded.
-    QMap<QString, QPair<double, double>> m_wheelSpeedAdjustmentFactors;
-    QMap<QString, QPair<double, double>> getWheelSpeedAdjustmentFactors(
-        const QMap<QString, Wheel>& wheels) const;
+    QVector<QPair<double, double>> getWheelSpeedAdjustmentFactors(
+        const QVector<Wheel>& wheels) const;
 
-    // Used to calculate the linear combination of the forward component and turn
-    // component, based on curve turn radius, that cause the mouse to perform a
-    // curve turn as optimally as possible
-    CurveTurnFactorCalculator m_curveTurnFactorCalculator;
+    // The precomputed movement primitives, indexed by MovementPrimitive
+    struct Primitive {
+        QVector<AngularVelocity> wheelSpeeds;
+        Speed forwardSpeed;
+        AngularVelocity turnRate;
+    };
+    QVector<Primitive> m_primitives;
 
     // The gyro (rate of rotation), rotation, and translation
     // of the mouse, which change throughout execution
@@ -192,7 +282,7 @@ private:
     mutable QMutex m_mutex;
 
     // Helper function for polygon retrieval based on a given mouse translation and rotation
-    Polygon getCurrentPolygon(
+    TransformedPolygon getCurrentPolygon(
         const Polygon& initialPolygon,
         const Coordinate& currentTranslation,
         const Angle& currentRotation) const;
@@ -203,8 +293,12 @@ private:
         const Coordinate& currentTranslation,
         const Angle& currentRotation) const;
 
-    // Sets the wheel speed for a particular movement, based on the linear combo of the two factors
-    void setWheelSpeedsForMovement(double fractionOfMaxSpeed, double forwardFactor, double turnFactor);
+    // Computes the wheel speeds for a particular movement, based on the linear
+    // combo of the two factors, and the velocity that results from them
+    Primitive getPrimitive(
+        const QVector<QPair<double, double>>& wheelSpeedAdjustmentFactors,
+        double forwardFactor,
+        double turnFactor) const;
 
 };
 
@@ -7,66 +7,87 @@ namespace mms {
 
 MouseGraphic::MouseGraphic(const Mouse* mouse) :
     m_mouse(mouse) {
-}
-
-Coordinate MouseGraphic::getInitialMouseTranslation() const {
-    return m_mouse->getInitialTranslation();
-}
-
-QPair<Coordinate, Angle> MouseGraphic::getCurrentMousePosition() const {
-    return {
-        m_mouse->getCurrentTranslation(),
-        m_mouse->getCurrentRotation(),
-    };
-}
 
-QVector<TriangleGraphic> MouseGraphic::draw(
-        const Coordinate& currentTranslation,
-        const Angle& currentRotation) const {
-
-    QVector<TriangleGraphic> buffer;
+    Coordinate initialTranslation = m_mouse->getInitialTranslation();
+    Angle initialRotation = m_mouse->getInitialRotation();
 
     // First, we draw the body
-    buffer.append(SimUtilities::polygonToTriangleGraphics(
-        m_mouse->getCurrentBodyPolygon(currentTranslation, currentRotation),
+    m_staticMesh.append(SimUtilities::polygonToTriangleGraphics(
+        m_mouse->getCurrentBodyPolygon(initialTranslation, initialRotation),
         STRING_TO_COLOR().value(P()->mouseBodyColor()), 1.0));
 
     // Next, draw the center of mass
-    buffer.append(SimUtilities::polygonToTriangleGraphics(
-        m_mouse->getCurrentCenterOfMassPolygon(currentTranslation, currentRotation),
+    m_staticMesh.append(SimUtilities::polygonToTriangleGraphics(
+        m_mouse->getCurrentCenterOfMassPolygon(initialTranslation, initialRotation),
         STRING_TO_COLOR().value(P()->mouseCenterOfMassColor()), 1.0));
 
     // Next, we draw the wheels
-    for (const Polygon& wheelPolygon :
-            m_mouse->getCurrentWheelPolygons(currentTranslation, currentRotation)) {
-        buffer.append(SimUtilities::polygonToTriangleGraphics(
+    for (const TransformedPolygon& wheelPolygon :
+            m_mouse->getCurrentWheelPolygons(initialTranslation, initialRotation)) {
+        m_staticMesh.append(SimUtilities::polygonToTriangleGraphics(
             wheelPolygon,
             STRING_TO_COLOR().value(P()->mouseWheelColor()), 1.0));
     }
 
-    // Next, we draw the sensors
-    for (const Polygon& sensorPolygon :
-            m_mouse->getCurrentSensorPolygons(currentTranslation, currentRotation)) {
-        buffer.append(SimUtilities::polygonToTriangleGraphics(
+    // Lastly, we draw the sensors
+    for (const TransformedPolygon& sensorPolygon :
+            m_mouse->getCurrentSensorPolygons(initialTranslation, initialRotation)) {
+        m_staticMesh.append(SimUtilities::polygonToTriangleGraphics(
             sensorPolygon,
             STRING_TO_COLOR().value(P()->mouseSensorColor()), 1.0));
     }
 
-    // Lastly, we draw the sensor views
+    // Uncomment to draw collision polygons
+    /*
+    for (const TransformedPolygon& collisionPolygon :
+            m_mouse->getCurrentCollisionPolygons(initialTranslation, initialRotation)) {
+        m_staticMesh.append(SimUtilities::polygonToTriangleGraphics(
+            collisionPolygon,
+            Color::GRAY, .5));
+    }
+    */
+}
+
+Coordinate MouseGraphic::getInitialMouseTranslation() const {
+    return m_mouse->getInitialTranslation();
+}
+
+QPair<Coordinate, Angle> MouseGraphic::getCurrentMousePosition() const {
+    return {
+        m_mouse->getCurrentTranslation(),
+        m_mouse->getCurrentRotation(),
+    };
+}
+
+const QVector<TriangleGraphic>& MouseGraphic::getStaticMesh() const {
+    return m_staticMesh;
+}
+
+QMatrix4x4 MouseGraphic::getPoseMatrix(
+        const Coordinate& currentTranslation,
+        const Angle& currentRotation) const {
+
+    // The same transformation that Mouse::getCurrentPolygon applies, embedded
+    // in a 4x4 matrix (given in row-major order) that leaves z unchanged
+    AffineTransform transform =
+        m_mouse->getCurrentTransform(currentTranslation, currentRotation);
+    return QMatrix4x4(
+        transform.getA(), transform.getB(), 0.0, transform.getTx(),
+        transform.getC(), transform.getD(), 0.0, transform.getTy(),
+        0.0, 0.0, 1.0, 0.0,
+        0.0, 0.0, 0.0, 1.0);
+}
+
+QVector<TriangleGraphic> MouseGraphic::drawSensorViews(
+        const Coordinate& currentTranslation,
+        const Angle& currentRotation) const {
+    QVector<TriangleGraphic> buffer;
     for (const Polygon& polygon :
             m_mouse->getCurrentSensorViewPolygons(currentTranslation, currentRotation)) {
         buffer.append(SimUtilities::polygonToTriangleGraphics(
             polygon,
             STRING_TO_COLOR().value(P()->mouseViewColor()), 1.0));
     }
-
-    // Uncomment to draw collision polygon
-    /*
-    buffer.append(SimUtilities::polygonToTriangleGraphics(
-        m_mouse->getCurrentCollisionPolygon(currentTranslation, currentRotation),
-        Color::GRAY, .5);
-    */
-
     return buffer;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QMatrix4x4>
 #include <QPair>
 #include <QVector>
 
@@ -14,18 +15,32 @@ class MouseGraphic {
 
 public:
 
+    // Should be constructed after the mouse has been reloaded, since the
+    // static mesh is built (and thus triangulated) exactly once, right here
     MouseGraphic(const Mouse* mouse);
 
     Coordinate getInitialMouseTranslation() const;
     QPair<Coordinate, Angle> getCurrentMousePosition() const;
 
-    QVector<TriangleGraphic> draw(
+    // The rigid parts of the mouse (body, center of mass, wheels, sensors),
+    // positioned at the mouse's initial translation and rotation
+    const QVector<TriangleGraphic>& getStaticMesh() const;
+
+    // Transforms the static mesh from the initial pose to the given pose
+    QMatrix4x4 getPoseMatrix(
+        const Coordinate& currentTranslation,
+        const Angle& currentRotation) const;
+
+    // The sensor views change shape as the mouse moves, so
+    // they're the only part that must be rebuilt every frame
+    QVector<TriangleGraphic> drawSensorViews(
         const Coordinate& currentTranslation,
         const Angle& currentRotation) const;
 
 private:
 
     const Mouse* m_mouse;
+    QVector<TriangleGraphic> m_staticMesh;
 
 };
 
@@ -251,36 +251,49 @@ QString MouseInterface::dispatch(const QString& command) {
         acknowledgeInputButtonPressed(inputButton);
         return ACK_STRING;
     }
-    else if (function == "getWheelMaxSpeed") {
+    else if (function == "getWheelHandle") {
         QString name = tokens.at(1);
-        return QString::number(getWheelMaxSpeed(name));
+        return QString::number(getWheelHandle(name));
     }
-    else if (function == "setWheelSpeed") {
+    else if (function == "getSensorHandle") {
         QString name = tokens.at(1);
+        return QString::number(getSensorHandle(name));
+    }
+    else if (function == "getWheelMaxSpeed") {
+        int wheel = getWheelHandleFromToken(tokens.at(1), "get its max speed");
+        return QString::number(wheel == -1 ? 0.0 : getWheelMaxSpeed(wheel));
+    }
+    else if (function == "setWheelSpeed") {
+        int wheel = getWheelHandleFromToken(tokens.at(1), "set its speed");
         double rpm = SimUtilities::strToDouble(tokens.at(2));
-        setWheelSpeed(name, rpm);
+        if (wheel != -1) {
+            setWheelSpeed(wheel, rpm);
+        }
         return ACK_STRING;
     }
     else if (function == "getWheelEncoderTicksPerRevolution") {
-        QString name = tokens.at(1);
+        int wheel = getWheelHandleFromToken(
+            tokens.at(1), "get its number of encoder ticks per revolution");
         return QString::number(
-            getWheelEncoderTicksPerRevolution(name)
+            wheel == -1 ? 0.0 : getWheelEncoderTicksPerRevolution(wheel)
         );
     }
     else if (function == "readWheelEncoder") {
-        QString name = tokens.at(1);
+        int wheel = getWheelHandleFromToken(tokens.at(1), "read its encoder");
         return QString::number(
-            readWheelEncoder(name)
+            wheel == -1 ? 0 : readWheelEncoder(wheel)
         );
     }
     else if (function == "resetWheelEncoder") {
-        QString name = tokens.at(1);
-        resetWheelEncoder(name);
+        int wheel = getWheelHandleFromToken(tokens.at(1), "reset its encoder");
+        if (wheel != -1) {
+            resetWheelEncoder(wheel);
+        }
         return ACK_STRING;
     }
     else if (function == "readSensor") {
-        QString name = tokens.at(1);
-        return QString::number(readSensor(name));
+        int sensor = getSensorHandleFromToken(tokens.at(1), "read its value");
+        return QString::number(sensor == -1 ? 0.0 : readSensor(sensor));
     }
     else if (function == "readGyro") {
         QString name = tokens.at(1);
@@ -418,6 +431,10 @@ DynamicMouseAlgorithmOptions MouseInterface::getDynamicOptions() const {
     return m_dynamicOptions;
 }   
 
+double MouseInterface::getWheelSpeedFraction() const {
+    return m_wheelSpeedFraction;
+}
+
 char MouseInterface::getStartedDirection() {
     return DIRECTION_TO_CHAR().value(m_mouse->getStartedDirection()).toLatin1();
 }
@@ -444,6 +461,7 @@ void MouseInterface::setWheelSpeedFraction(double wheelSpeedFraction) {
     }
     */
     m_wheelSpeedFraction = wheelSpeedFraction;
+    emit wheelSpeedFractionChanged(wheelSpeedFraction);
 }
 
 
@@ -664,91 +682,119 @@ void MouseInterface::acknowledgeInputButtonPressed(int inputButton) {
     emit inputButtonWasAcknowledged(inputButton);
 }
 
-double MouseInterface::getWheelMaxSpeed(const QString& name) {
+int MouseInterface::getWheelHandle(const QString& name) {
 
     ENSURE_CONTINUOUS_INTERFACE
 
-    if (!m_mouse->hasWheel(name)) {
+    int wheel = m_mouse->getWheelHandle(name);
+    if (wheel == -1) {
         qWarning().noquote().nospace()
             << "There is no wheel called \"" << name << "\" and thus you cannot"
-            << " get its max speed.";
+            << " get its handle.";
+    }
+    return wheel;
+}
+
+int MouseInterface::getSensorHandle(const QString& name) {
+
+    ENSURE_CONTINUOUS_INTERFACE
+
+    int sensor = m_mouse->getSensorHandle(name);
+    if (sensor == -1) {
+        qWarning().noquote().nospace()
+            << "There is no sensor called \"" << name << "\" and thus you"
+            << " cannot get its handle.";
+    }
+    return sensor;
+}
+
+double MouseInterface::getWheelMaxSpeed(int wheel) {
+
+    ENSURE_CONTINUOUS_INTERFACE
+
+    if (!m_mouse->hasWheel(wheel)) {
+        qWarning().noquote().nospace()
+            << "There is no wheel with handle " << wheel << " and thus you"
+            << " cannot get its max speed.";
         return 0.0;
     }
 
-    return m_mouse->getWheelMaxSpeed(name).getRevolutionsPerMinute();
+    return m_mouse->getWheelMaxSpeed(wheel).getRevolutionsPerMinute();
 }
 
-void MouseInterface::setWheelSpeed(const QString& name, double rpm) {
+void MouseInterface::setWheelSpeed(int wheel, double rpm) {
 
     ENSURE_CONTINUOUS_INTERFACE
 
-    if (!m_mouse->hasWheel(name)) {
+    if (!m_mouse->hasWheel(wheel)) {
         qWarning().noquote().nospace()
-            << "There is no wheel called \"" << name << "\" and thus you cannot"
-            << " set its speed.";
+            << "There is no wheel with handle " << wheel << " and thus you"
+            << " cannot set its speed.";
         return;
     }
 
-    if (getWheelMaxSpeed(name) < std::abs(rpm)) {
+    double maxSpeed = m_mouse->getWheelMaxSpeed(wheel).getRevolutionsPerMinute();
+    if (maxSpeed < std::abs(rpm)) {
         qWarning().noquote().nospace()
-            << "You're attempting to set the speed of wheel \"" << name << "\""
-            << " to " << rpm << " rpm, which has magnitude greater than the max"
-            << " speed of " << getWheelMaxSpeed(name) << " rpm. Thus, the wheel"
-            << " speed was not set.";
+            << "You're attempting to set the speed of wheel \""
+            << m_mouse->getWheelName(wheel) << "\" to " << rpm << " rpm, which"
+            << " has magnitude greater than the max speed of " << maxSpeed
+            << " rpm. Thus, the wheel speed was not set.";
         return;
     }
 
-    m_mouse->setWheelSpeeds({{name, AngularVelocity::RevolutionsPerMinute(rpm)}});
+    m_mouse->setWheelSpeed(wheel, AngularVelocity::RevolutionsPerMinute(rpm));
 }
 
-double MouseInterface::getWheelEncoderTicksPerRevolution(const QString& name) {
+double MouseInterface::getWheelEncoderTicksPerRevolution(int wheel) {
 
     ENSURE_CONTINUOUS_INTERFACE
 
-    if (!m_mouse->hasWheel(name)) {
+    if (!m_mouse->hasWheel(wheel)) {
         qWarning().noquote().nospace()
-            << "There is no wheel called \"" << name << "\" and thus you cannot"
-            << " get its number of encoder ticks per revolution.";
+            << "There is no wheel with handle " << wheel << " and thus you"
+            << " cannot get its number of encoder ticks per revolution.";
         return 0.0;
     }
 
-    return m_mouse->getWheelEncoderTicksPerRevolution(name);
+    return m_mouse->getWheelEncoderTicksPerRevolution(wheel);
 }
 
-int MouseInterface::readWheelEncoder(const QString& name) {
+int MouseInterface::readWheelEncoder(int wheel) {
 
     ENSURE_CONTINUOUS_INTERFACE
 
-    if (!m_mouse->hasWheel(name)) {
+    if (!m_mouse->hasWheel(wheel)) {
         qWarning().noquote().nospace()
-            << "There is no wheel called \"" << name << "\" and thus you cannot"
-            << " read its encoder.";
+            << "There is no wheel with handle " << wheel << " and thus you"
+            << " cannot read its encoder.";
         return 0;
     }
 
-    switch (m_mouse->getWheelEncoderType(name)) {
+    switch (m_mouse->getWheelEncoderType(wheel)) {
         case EncoderType::ABSOLUTE:
-            return m_mouse->readWheelAbsoluteEncoder(name);
+            return m_mouse->readWheelAbsoluteEncoder(wheel);
         case EncoderType::RELATIVE:
-            return m_mouse->readWheelRelativeEncoder(name);
+            return m_mouse->readWheelRelativeEncoder(wheel);
     }
 }
 
-void MouseInterface::resetWheelEncoder(const QString& name) {
+void MouseInterface::resetWheelEncoder(int wheel) {
 
     ENSURE_CONTINUOUS_INTERFACE
 
-    if (!m_mouse->hasWheel(name)) {
+    if (!m_mouse->hasWheel(wheel)) {
         qWarning().noquote().nospace()
-            << "There is no wheel called \"" << name << "\" and thus you cannot"
-            << " reset its encoder.";
+            << "There is no wheel with handle " << wheel << " and thus you"
+            << " cannot reset its encoder.";
         return;
     }
 
-    if (m_mouse->getWheelEncoderType(name) != EncoderType::RELATIVE) {
+    if (m_mouse->getWheelEncoderType(wheel) != EncoderType::RELATIVE) {
         qWarning().noquote().nospace()
-            << "The encoder type of the wheel \"" << name << "\" is \""
-            << ENCODER_TYPE_TO_STRING().value(m_mouse->getWheelEncoderType(name))
+            << "The encoder type of the wheel \"" << m_mouse->getWheelName(wheel)
+            << "\" is \""
+            << ENCODER_TYPE_TO_STRING().value(m_mouse->getWheelEncoderType(wheel))
             << "\". However, you may only reset the wheel encoder if the"
             << " encoder type is \""
             << ENCODER_TYPE_TO_STRING().value(EncoderType::RELATIVE)
@@ -756,21 +802,21 @@ void MouseInterface::resetWheelEncoder(const QString& name) {
         return;
     }
 
-    m_mouse->resetWheelRelativeEncoder(name);
+    m_mouse->resetWheelRelativeEncoder(wheel);
 }
 
-double MouseInterface::readSensor(const QString& name) {
+double MouseInterface::readSensor(int sensor) {
 
     ENSURE_CONTINUOUS_INTERFACE
 
-    if (!m_mouse->hasSensor(name)) {
+    if (!m_mouse->hasSensor(sensor)) {
         qWarning().noquote().nospace()
-            << "There is no sensor called \"" << name << "\" and thus you"
+            << "There is no sensor with handle " << sensor << " and thus you"
             << " cannot read its value.";
         return 0.0;
     }
 
-    return m_mouse->readSensor(name);
+    return m_mouse->readSensor(sensor);
 }
 
 double MouseInterface::readGyro() {
@@ -1089,6 +1135,38 @@ void MouseInterface::ensureOutsideOrigin(const QString& callingFunction) const {
     }
 }
 
+int MouseInterface::getWheelHandleFromToken(const QString& token, const QString& action) const {
+    // Names take precedence, so that a wheel whose name looks like an
+    // integer is never mistaken for the wheel with that handle
+    int wheel = m_mouse->getWheelHandle(token);
+    if (wheel == -1 && SimUtilities::isInt(token)) {
+        wheel = SimUtilities::strToInt(token);
+    }
+    if (!m_mouse->hasWheel(wheel)) {
+        qWarning().noquote().nospace()
+            << "There is no wheel with name or handle \"" << token << "\" and"
+            << " thus you cannot " << action << ".";
+        return -1;
+    }
+    return wheel;
+}
+
+int MouseInterface::getSensorHandleFromToken(const QString& token, const QString& action) const {
+    // Names take precedence, so that a sensor whose name looks like an
+    // integer is never mistaken for the sensor with that handle
+    int sensor = m_mouse->getSensorHandle(token);
+    if (sensor == -1 && SimUtilities::isInt(token)) {
+        sensor = SimUtilities::strToInt(token);
+    }
+    if (!m_mouse->hasSensor(sensor)) {
+        qWarning().noquote().nospace()
+            << "There is no sensor with name or handle \"" << token << "\" and"
+            << " thus you cannot " << action << ".";
+        return -1;
+    }
+    return sensor;
+}
+
 void MouseInterface::setTileColorImpl(int x, int y, char color) {
     m_view->getMazeGraphic()->setTileColor(x, y, CHAR_TO_COLOR().value(color));
     m_tilesWithColor.insert({x, y});
@@ -1256,7 +1334,6 @@ void MouseInterface::turnAroundToEdgeImpl(bool turnLeft) {
 
 void MouseInterface::turnToEdgeImpl(bool turnLeft) {
 
-    static Distance halfWallLength = Distance::Meters(P()->wallLength() / 2.0);
     static Distance wallWidth = Distance::Meters(P()->wallWidth());
 
     // Whether or not this movement will cause a crash
@@ -1276,7 +1353,8 @@ void MouseInterface::turnToEdgeImpl(bool turnLeft) {
     );
 
     // Perform the curve turn
-    arcTo(crashLocation.first, crashLocation.second, halfWallLength, 1.0);
+    arcTo(crashLocation.first, crashLocation.second,
+        MovementPrimitive::CURVE_LEFT, MovementPrimitive::CURVE_RIGHT, 1.0);
 
     // If we didn't crash, move forward into the new tile
     if (!crash) {
@@ -1300,7 +1378,7 @@ bool MouseInterface::isWall(QPair<QPair<int, int>, Direction> wall, bool declare
 
     ASSERT_TR(m_maze->withinMaze(x, y));
 
-    bool wallExists = m_maze->getTile(x, y)->isWall(direction);
+    bool wallExists = m_maze->isWall(x, y, direction);
 
     if (declareWallOnRead) {
         declareWallImpl(wall, wallExists, declareBothWallHalves);
@@ -1354,13 +1432,17 @@ void MouseInterface::moveForwardTo(const Coordinate& destinationTranslation, con
     Distance previousDistance = delta.getRho();
 
     // Start the mouse moving forward
-    m_mouse->setWheelSpeedsForMoveForward(m_wheelSpeedFraction);
+    m_mouse->setWheelSpeedsForPrimitive(MovementPrimitive::FORWARD, m_wheelSpeedFraction);
 
     // Move forward until we've reached the destination
     do {
         // Assert that we're actually moving closer to the destination
         ASSERT_LE(delta.getRho().getMeters(), previousDistance.getMeters());
         previousDistance = delta.getRho();
+        // The mouse stops moving once it crashes
+        if (m_mouse->didCrash()) {
+            break;
+        }
         // Check if a stop has been requested
         BREAK_IF_STOPPED_ELSE_SLEEP_MIN();
         // Update the translation delta
@@ -1370,25 +1452,28 @@ void MouseInterface::moveForwardTo(const Coordinate& destinationTranslation, con
     while (std::abs((delta.getTheta() - initialAngle).getDegreesZeroTo360()) <  90
         || std::abs((delta.getTheta() - initialAngle).getDegreesZeroTo360()) > 270);
 
-    // Stop the wheels and teleport to the exact destination
+    // Stop the wheels and, unless the mouse crashed along the way (in which
+    // case it stays where it hit), teleport to the exact destination
     m_mouse->stopAllWheels();
-    m_mouse->teleport(destinationTranslation, destinationRotation);
+    if (!m_mouse->didCrash()) {
+        m_mouse->teleport(destinationTranslation, destinationRotation);
+    }
 }
 
 void MouseInterface::arcTo(const Coordinate& destinationTranslation, const Angle& destinationRotation,
-        const Distance& radius, double extraWheelSpeedFraction) {
+        MovementPrimitive leftPrimitive, MovementPrimitive rightPrimitive, double extraWheelSpeedFraction) {
 
     // Determine the inital rotation delta in [-180, 180)
     Angle initialRotationDelta = getRotationDelta(m_mouse->getCurrentRotation(), destinationRotation);
 
     // Set the speed based on the initial rotation delta
     if (0 < initialRotationDelta.getDegreesUnbounded()) {
-        m_mouse->setWheelSpeedsForCurveLeft(
-            m_wheelSpeedFraction * extraWheelSpeedFraction, radius);
+        m_mouse->setWheelSpeedsForPrimitive(
+            leftPrimitive, m_wheelSpeedFraction * extraWheelSpeedFraction);
     }
     else {
-        m_mouse->setWheelSpeedsForCurveRight(
-            m_wheelSpeedFraction * extraWheelSpeedFraction, radius);
+        m_mouse->setWheelSpeedsForPrimitive(
+            rightPrimitive, m_wheelSpeedFraction * extraWheelSpeedFraction);
     }
     
     // While the deltas have the same sign, sleep for a short amount of time
@@ -1398,17 +1483,24 @@ void MouseInterface::arcTo(const Coordinate& destinationTranslation, const Angle
                 m_mouse->getCurrentRotation(),
                 destinationRotation
             ).getRadiansUnbounded()) {
+        if (m_mouse->didCrash()) {
+            break;
+        }
         BREAK_IF_STOPPED_ELSE_SLEEP_MIN();
     }
 
-    // Stop the wheels and teleport to the exact destination
+    // Stop the wheels and, unless the mouse crashed along the way (in which
+    // case it stays where it hit), teleport to the exact destination
     m_mouse->stopAllWheels();
-    m_mouse->teleport(destinationTranslation, destinationRotation);
+    if (!m_mouse->didCrash()) {
+        m_mouse->teleport(destinationTranslation, destinationRotation);
+    }
 }
 
 void MouseInterface::turnTo(const Coordinate& destinationTranslation, const Angle& destinationRotation) {
     // When we're turning in place, we set the wheels to half speed
-    arcTo(destinationTranslation, destinationRotation, Distance::Meters(0), 0.5);
+    arcTo(destinationTranslation, destinationRotation,
+        MovementPrimitive::TURN_LEFT, MovementPrimitive::TURN_RIGHT, 0.5);
 }
 
 Angle MouseInterface::getRotationDelta(const Angle& from, const Angle& to) const {
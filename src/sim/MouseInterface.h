@@ -8,6 +8,7 @@
 #include "InterfaceType.h"
 #include "MazeView.h"
 #include "Mouse.h"
+#include "MovementPrimitive.h"
 #include "Param.h"
 
 #define ENSURE_DISCRETE_INTERFACE ensureDiscreteInterface(__func__);
@@ -52,6 +53,7 @@ public:
     // Parameters set by the algorithm
     InterfaceType getInterfaceType(bool canFinalize) const;
     DynamicMouseAlgorithmOptions getDynamicOptions() const;
+    double getWheelSpeedFraction() const;
 
 signals:
 
@@ -67,6 +69,10 @@ signals:
     // The algorithm could not be started
     void mouseAlgoCannotStart(QString errorString);
 
+    // The algorithm changed the fraction of the max wheel speeds that the
+    // discrete movements use
+    void wheelSpeedFractionChanged(double wheelSpeedFraction);
+
 private:
 
     // *********************** START PUBLIC INTERFACE ******************** //
@@ -113,23 +119,29 @@ private:
 
     // ----- Continuous interface methods ----- //
 
+    // Wheels and sensors are referred to by integer handles, which are
+    // resolved from their names once, rather than on every call. These
+    // return -1 if there's no wheel or sensor by the given name.
+    int getWheelHandle(const QString& name);
+    int getSensorHandle(const QString& name);
+
     // Get the magnitude of the max speed of any one wheel in rpm
-    double getWheelMaxSpeed(const QString& name);
+    double getWheelMaxSpeed(int wheel);
 
     // Set the speed of any one wheel
-    void setWheelSpeed(const QString& name, double rpm);
+    void setWheelSpeed(int wheel, double rpm);
 
     // Get the number of encoder ticks per revolution for a wheel
-    double getWheelEncoderTicksPerRevolution(const QString& name);
+    double getWheelEncoderTicksPerRevolution(int wheel);
 
     // Read the encoder for a particular wheel
-    int readWheelEncoder(const QString& name);
+    int readWheelEncoder(int wheel);
 
     // Reset the encoder for a particular wheel to zero, but only if the encoder type is relative
-    void resetWheelEncoder(const QString& name);
+    void resetWheelEncoder(int wheel);
 
     // Returns a value in [0.0, 1.0]
-    double readSensor(const QString& name);
+    double readSensor(int sensor);
 
     // Returns deg/s of rotation
     double readGyro();
@@ -221,6 +233,12 @@ private:
     void ensureInsideOrigin(const QString& callingFunction) const;
     void ensureOutsideOrigin(const QString& callingFunction) const;
 
+    // Resolve a protocol token, which is either a name or a handle, to a
+    // wheel or sensor handle; if there's no such wheel or sensor, warns that
+    // the action can't be performed and returns -1
+    int getWheelHandleFromToken(const QString& token, const QString& action) const;
+    int getSensorHandleFromToken(const QString& token, const QString& action) const;
+
     // Implementation methods:
     // Any functionality that is executed as part of another MouseInterface
     // method should have an Impl method, and the Impl method should be called.
@@ -257,7 +275,7 @@ private:
     // Some helper abstractions for mouse movements
     void moveForwardTo(const Coordinate& destinationTranslation, const Angle& destinationRotation);
     void arcTo(const Coordinate& destinationTranslation, const Angle& destinationRotation,
-        const Distance& radius, double extraWheelSpeedFraction);
+        MovementPrimitive leftPrimitive, MovementPrimitive rightPrimitive, double extraWheelSpeedFraction);
     void turnTo(const Coordinate& destinationTranslation, const Angle& destinationRotation);
 
     // Returns the angle with from "from" to "to", with values in [-180, 180) degrees
@@ -4,10 +4,13 @@
 #include <QFile>
 #include <QVector>
 
+#include <limits>
+
 #include "Assert.h"
 #include "EncoderType.h"
 #include "GeometryUtilities.h"
 #include "SimUtilities.h"
+#include "units/AngularAcceleration.h"
 #include "units/AngularVelocity.h"
 
 namespace mms {
@@ -33,6 +36,19 @@ const QString MouseParser::DIRECTION_TAG = "Direction";
 const QString MouseParser::MAX_SPEED_TAG = "Max-Speed";
 const QString MouseParser::ENCODER_TYPE_TAG = "Encoder-Type";
 const QString MouseParser::ENCODER_TICKS_PER_REVOLUTION_TAG = "Encoder-Ticks-Per-Revolution";
+const QString MouseParser::MOTOR_TAG = "Motor";
+const QString MouseParser::MAX_ACCELERATION_TAG = "Max-Acceleration";
+const QString MouseParser::MAX_DECELERATION_TAG = "Max-Deceleration";
+const QString MouseParser::TIME_CONSTANT_TAG = "Time-Constant";
+const QString MouseParser::TORQUE_CURVE_TAG = "Torque-Curve";
+const QString MouseParser::POINT_TAG = "Point";
+const QString MouseParser::SPEED_TAG = "Speed";
+const QString MouseParser::TORQUE_TAG = "Torque";
+const QString MouseParser::NOISE_TAG = "Noise";
+const QString MouseParser::BIAS_TAG = "Bias";
+const QString MouseParser::STANDARD_DEVIATION_TAG = "Standard-Deviation";
+const QString MouseParser::QUANTIZATION_TAG = "Quantization";
+const QString MouseParser::GYRO_TAG = "Gyro";
 const QString MouseParser::SENSOR_TAG = "Sensor";
 const QString MouseParser::RADIUS_TAG = "Radius";
 const QString MouseParser::RANGE_TAG = "Range";
@@ -109,7 +125,7 @@ Polygon MouseParser::getBody(
     Polygon bodyPolygon;
     if (success) {
         bodyPolygon = Polygon(vertices);
-        if (bodyPolygon.getTriangles().size() == 0) {
+        if (bodyPolygon.getTriangulation().isEmpty()) {
             qWarning()
                 << "Invalid mouse" << BODY_TAG
                 << "- the vertices specified aren't a simple polygon.";
@@ -148,6 +164,8 @@ QMap<QString, Wheel> MouseParser::getWheels(
         EncoderType encoderType = getEncoderTypeIfValid(wheel, success);
         double encoderTicksPerRevolution = getDoubleIfHasDoubleAndNonNegative(
             wheel, ENCODER_TICKS_PER_REVOLUTION_TAG, success);
+        Motor motor = getMotorIfValid(wheel, success);
+        Noise encoderNoise = getNoiseIfValid(wheel, success);
 
         if (success) {
             wheels.insert(
@@ -164,8 +182,10 @@ QMap<QString, Wheel> MouseParser::getWheels(
                     Distance::Meters(diameter),
                     Distance::Meters(width),
                     AngularVelocity::RevolutionsPerMinute(maxAngularVelocityMagnitude),
-                    encoderType, 
-                    encoderTicksPerRevolution));
+                    motor,
+                    encoderType,
+                    encoderTicksPerRevolution,
+                    encoderNoise));
         }
     }
 
@@ -194,6 +214,7 @@ QMap<QString, Sensor> MouseParser::getSensors(
         double x = getDoubleIfHasDouble(position, X_TAG, success);
         double y = getDoubleIfHasDouble(position, Y_TAG, success);
         double direction = getDoubleIfHasDouble(sensor, DIRECTION_TAG, success);
+        Noise noise = getNoiseIfValid(sensor, success);
 
         if (success) {
             sensors.insert(
@@ -208,13 +229,18 @@ QMap<QString, Sensor> MouseParser::getSensors(
                         alignmentRotation,
                         initialTranslation),
                     Angle::Degrees(direction) + alignmentRotation,
-                    maze));
+                    maze,
+                    noise));
         }
     }
 
     return sensors;
 }
 
+Noise MouseParser::getGyroNoise(bool* success) {
+    return getNoiseIfValid(m_root.firstChildElement(GYRO_TAG), success);
+}
+
 double MouseParser::getDoubleIfHasDouble(const QDomElement& element, const QString& tag, bool* success) {
     QString valueString = element.firstChildElement(tag).text();
     if (!SimUtilities::isDouble(valueString)) {
@@ -270,6 +296,105 @@ EncoderType MouseParser::getEncoderTypeIfValid(const QDomElement& element, bool*
     return encoderType;
 }
 
+Motor MouseParser::getMotorIfValid(const QDomElement& element, bool* success) {
+
+    // The motor is optional, as are each of its properties, and any that
+    // aren't specified are ideal
+    QDomElement motor = element.firstChildElement(MOTOR_TAG);
+    if (motor.isNull()) {
+        return Motor();
+    }
+
+    double maxAcceleration = std::numeric_limits<double>::infinity();
+    double maxDeceleration = std::numeric_limits<double>::infinity();
+    double timeConstant = 0.0;
+    if (!motor.firstChildElement(MAX_ACCELERATION_TAG).isNull()) {
+        maxAcceleration = getDoubleIfHasDoubleAndNonNegative(motor, MAX_ACCELERATION_TAG, success);
+    }
+    if (!motor.firstChildElement(MAX_DECELERATION_TAG).isNull()) {
+        maxDeceleration = getDoubleIfHasDoubleAndNonNegative(motor, MAX_DECELERATION_TAG, success);
+    }
+    if (!motor.firstChildElement(TIME_CONSTANT_TAG).isNull()) {
+        timeConstant = getDoubleIfHasDoubleAndNonNegative(motor, TIME_CONSTANT_TAG, success);
+    }
+    if (maxAcceleration == 0.0 || maxDeceleration == 0.0) {
+        qWarning().noquote().nospace()
+            << "The values for tags \"" << MAX_ACCELERATION_TAG << "\" and \""
+            << MAX_DECELERATION_TAG << "\" must be greater than zero.";
+        *success = false;
+    }
+
+    QVector<QPair<AngularVelocity, double>> torqueCurve;
+    QDomNodeList elementList = motor
+        .firstChildElement(TORQUE_CURVE_TAG)
+        .elementsByTagName(POINT_TAG);
+    for (int i = 0; i < elementList.size(); i += 1) {
+        QDomElement point = elementList.at(i).toElement();
+        double speed = getDoubleIfHasDoubleAndNonNegative(point, SPEED_TAG, success);
+        double torque = getDoubleIfHasDoubleAndNonNegative(point, TORQUE_TAG, success);
+        if (1.0 < torque) {
+            qWarning().noquote().nospace()
+                << "The value for tag \"" << TORQUE_TAG << "\" is " << torque
+                << ", which is greater than the maximum allowed value of "
+                << 1.0 << ".";
+            *success = false;
+        }
+        if (!torqueCurve.isEmpty() &&
+                speed <= torqueCurve.last().first.getRevolutionsPerMinute()) {
+            qWarning().noquote().nospace()
+                << "The values for tag \"" << SPEED_TAG << "\" of the \""
+                << TORQUE_CURVE_TAG << "\" must be strictly increasing.";
+            *success = false;
+        }
+        torqueCurve.append({AngularVelocity::RevolutionsPerMinute(speed), torque});
+    }
+
+    // With no torque at the lowest speed, a stopped wheel could never start
+    if (!torqueCurve.isEmpty() && torqueCurve.first().second == 0.0) {
+        qWarning().noquote().nospace()
+            << "The value for tag \"" << TORQUE_TAG << "\" of the first point"
+            << " of the \"" << TORQUE_CURVE_TAG << "\" must be greater than zero.";
+        *success = false;
+    }
+
+    if (!*success) {
+        return Motor();
+    }
+    return Motor(
+        AngularAcceleration::RevolutionsPerMinutePerSecond(maxAcceleration),
+        AngularAcceleration::RevolutionsPerMinutePerSecond(maxDeceleration),
+        Duration::Seconds(timeConstant),
+        torqueCurve);
+}
+
+Noise MouseParser::getNoiseIfValid(const QDomElement& element, bool* success) {
+
+    // The noise is optional, as are each of its properties, and any that
+    // aren't specified are zero, i.e., perfect
+    QDomElement noise = element.firstChildElement(NOISE_TAG);
+    if (noise.isNull()) {
+        return Noise();
+    }
+
+    double bias = 0.0;
+    double standardDeviation = 0.0;
+    double quantization = 0.0;
+    if (!noise.firstChildElement(BIAS_TAG).isNull()) {
+        bias = getDoubleIfHasDouble(noise, BIAS_TAG, success);
+    }
+    if (!noise.firstChildElement(STANDARD_DEVIATION_TAG).isNull()) {
+        standardDeviation = getDoubleIfHasDoubleAndNonNegative(noise, STANDARD_DEVIATION_TAG, success);
+    }
+    if (!noise.firstChildElement(QUANTIZATION_TAG).isNull()) {
+        quantization = getDoubleIfHasDoubleAndNonNegative(noise, QUANTIZATION_TAG, success);
+    }
+
+    if (!*success) {
+        return Noise();
+    }
+    return Noise(bias, standardDeviation, quantization);
+}
+
 Coordinate MouseParser::alignVertex(
     const Coordinate& vertex,
     const Coordinate& alignmentTranslation,
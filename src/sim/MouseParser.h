@@ -11,6 +11,8 @@
 
 #include "Logging.h"
 #include "Maze.h"
+#include "Motor.h"
+#include "Noise.h"
 #include "Polygon.h"
 #include "Sensor.h"
 #include "units/Coordinate.h"
@@ -40,6 +42,8 @@ public:
         const Maze& maze,
         bool* success);
 
+    Noise getGyroNoise(bool* success);
+
 private:
     QDomDocument m_doc;
     QDomElement m_root;
@@ -51,6 +55,8 @@ private:
         const QDomElement& element, const QString& tag, bool* success);
     QDomElement getContainerElement(const QDomElement& element, const QString& tag, bool* success);
     EncoderType getEncoderTypeIfValid(const QDomElement& element, bool* success);
+    Motor getMotorIfValid(const QDomElement& element, bool* success);
+    Noise getNoiseIfValid(const QDomElement& element, bool* success);
 
     Coordinate alignVertex(
         const Coordinate& vertex,
@@ -75,6 +81,19 @@ private:
     static const QString MAX_SPEED_TAG;
     static const QString ENCODER_TYPE_TAG;
     static const QString ENCODER_TICKS_PER_REVOLUTION_TAG;
+    static const QString MOTOR_TAG;
+    static const QString MAX_ACCELERATION_TAG;
+    static const QString MAX_DECELERATION_TAG;
+    static const QString TIME_CONSTANT_TAG;
+    static const QString TORQUE_CURVE_TAG;
+    static const QString POINT_TAG;
+    static const QString SPEED_TAG;
+    static const QString TORQUE_TAG;
+    static const QString NOISE_TAG;
+    static const QString BIAS_TAG;
+    static const QString STANDARD_DEVIATION_TAG;
+    static const QString QUANTIZATION_TAG;
+    static const QString GYRO_TAG;
     static const QString SENSOR_TAG;
     static const QString RADIUS_TAG;
     static const QString RANGE_TAG;
@@ -0,0 +1,24 @@
+#include "MovementPrimitive.h"
+
+#include "ContainerUtilities.h"
+
+namespace mms {
+
+const QMap<MovementPrimitive, QString>& MOVEMENT_PRIMITIVE_TO_STRING() {
+    static const QMap<MovementPrimitive, QString> map = {
+        {MovementPrimitive::FORWARD, "FORWARD"},
+        {MovementPrimitive::TURN_LEFT, "TURN_LEFT"},
+        {MovementPrimitive::TURN_RIGHT, "TURN_RIGHT"},
+        {MovementPrimitive::CURVE_LEFT, "CURVE_LEFT"},
+        {MovementPrimitive::CURVE_RIGHT, "CURVE_RIGHT"},
+    };
+    return map;
+}
+
+const QMap<QString, MovementPrimitive>& STRING_TO_MOVEMENT_PRIMITIVE() {
+    static const QMap<QString, MovementPrimitive> map =
+        ContainerUtilities::inverse(MOVEMENT_PRIMITIVE_TO_STRING());
+    return map;
+}
+
+} // namespace mms
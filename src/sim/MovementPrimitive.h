@@ -0,0 +1,31 @@
+#pragma once
+
+#include <QDebug>
+#include <QMap>
+#include <QString>
+
+#include "ContainerUtilities.h"
+
+namespace mms {
+
+// The movements that the discrete interface is built from. The diagonals are
+// made of in-place turns and forward movements, and the curves are the
+// quarter turns along the edges of tiles (i.e., with a radius of half of a
+// wall length) used by the "ToEdge" movements.
+enum class MovementPrimitive {
+    FORWARD,
+    TURN_LEFT,
+    TURN_RIGHT,
+    CURVE_LEFT,
+    CURVE_RIGHT,
+};
+
+const QMap<MovementPrimitive, QString>& MOVEMENT_PRIMITIVE_TO_STRING();
+const QMap<QString, MovementPrimitive>& STRING_TO_MOVEMENT_PRIMITIVE();
+
+inline QDebug operator<<(QDebug stream, MovementPrimitive movementPrimitive) {
+    stream.noquote() << MOVEMENT_PRIMITIVE_TO_STRING().value(movementPrimitive);
+    return stream;
+}
+
+} // namespace mms
@@ -0,0 +1,90 @@
+#include "Noise.h"
+
+#include <QtMath>
+
+#include "Assert.h"
+#include "Param.h"
+
+namespace mms {
+
+Noise::Noise() :
+    m_bias(0.0),
+    m_standardDeviation(0.0),
+    m_quantization(0.0),
+    m_seed(0) {
+}
+
+Noise::Noise(double bias, double standardDeviation, double quantization) :
+    m_bias(bias),
+    m_standardDeviation(standardDeviation),
+    m_quantization(quantization),
+    m_seed(static_cast<quint32>(P()->randomSeed())) {
+    ASSERT_LE(0.0, m_standardDeviation);
+    ASSERT_LE(0.0, m_quantization);
+}
+
+bool Noise::isNone() const {
+    return m_bias == 0.0 && m_standardDeviation == 0.0 && m_quantization == 0.0;
+}
+
+double Noise::apply(double value, quint32 stream, quint64 sample) const {
+
+    // NOTE: This is a performance critical function
+
+    value += m_bias;
+    if (0.0 < m_standardDeviation) {
+        value += m_standardDeviation * getGaussian(m_seed, stream, sample);
+    }
+    if (0.0 < m_quantization) {
+        value = std::round(value / m_quantization) * m_quantization;
+    }
+    return value;
+}
+
+double Noise::getGaussian(quint32 seed, quint32 stream, quint64 sample) {
+
+    quint32 counter[4] = {
+        static_cast<quint32>(sample),
+        static_cast<quint32>(sample >> 32),
+        0,
+        0,
+    };
+    quint32 key[2] = {seed, stream};
+    philox(counter, key);
+
+    // Two uniform samples in (0, 1], from 64 bits each, and then the
+    // Box-Muller transform (we only need one of the two normal samples)
+    static const double scale = 1.0 / 18446744073709551616.0; // 2^-64
+    double u1 = ((static_cast<quint64>(counter[0]) << 32 | counter[1]) + 1.0) * scale;
+    double u2 = ((static_cast<quint64>(counter[2]) << 32 | counter[3]) + 1.0) * scale;
+    return std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * M_PI * u2);
+}
+
+void Noise::philox(quint32 counter[4], quint32 key[2]) {
+
+    // The constants from Salmon et al., "Parallel Random Numbers: As Easy as
+    // 1, 2, 3", which pass BigCrush with ten rounds
+    static const quint64 M0 = 0xD2511F53;
+    static const quint64 M1 = 0xCD9E8D57;
+    static const quint32 W0 = 0x9E3779B9;
+    static const quint32 W1 = 0xBB67AE85;
+
+    quint32 k0 = key[0];
+    quint32 k1 = key[1];
+    for (int i = 0; i < 10; i += 1) {
+        quint64 product0 = M0 * counter[0];
+        quint64 product1 = M1 * counter[2];
+        quint32 c0 = static_cast<quint32>(product1 >> 32) ^ counter[1] ^ k0;
+        quint32 c1 = static_cast<quint32>(product1);
+        quint32 c2 = static_cast<quint32>(product0 >> 32) ^ counter[3] ^ k1;
+        quint32 c3 = static_cast<quint32>(product0);
+        counter[0] = c0;
+        counter[1] = c1;
+        counter[2] = c2;
+        counter[3] = c3;
+        k0 += W0;
+        k1 += W1;
+    }
+}
+
+} // namespace mms
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <QtGlobal>
+
+namespace mms {
+
+// The imperfections of a sensor, an encoder, or the gyro: a constant bias,
+// zero-mean Gaussian noise, and quantization to a fixed step, applied in that
+// order. The noise comes from a counter-based generator (Philox4x32-10), so
+// each sample is a pure function of the random seed, the stream (i.e., which
+// sensor, encoder, etc.), and the sample number (i.e., the sim tick). That
+// means the noise is reproducible for a given seed, no matter which threads
+// do the reading, or how many times, or in what order, and that reading is
+// cheap, since there's no generator state to lock or advance.
+class Noise {
+
+public:
+
+    // No bias, noise, or quantization
+    Noise();
+    Noise(double bias, double standardDeviation, double quantization);
+
+    // Whether or not apply() returns the value unchanged
+    bool isNone() const;
+
+    // Returns the value, with the bias, noise, and quantization applied
+    double apply(double value, quint32 stream, quint64 sample) const;
+
+    // Returns a standard normal sample for the stream and sample number
+    static double getGaussian(quint32 seed, quint32 stream, quint64 sample);
+
+private:
+
+    double m_bias;
+    double m_standardDeviation;
+    double m_quantization;
+
+    // Captured at construction, so that all streams share the same seed
+    quint32 m_seed;
+
+    // Encrypts the counter with the key, in place
+    static void philox(quint32 counter[4], quint32 key[2]);
+
+};
+
+} // namespace mms
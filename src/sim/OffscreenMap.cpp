@@ -0,0 +1,183 @@
+#include "OffscreenMap.h"
+
+#include <QPainter>
+#include <QPolygonF>
+
+#include <algorithm>
+
+#include "Assert.h"
+#include "FontImage.h"
+#include "Param.h"
+
+namespace mms {
+
+OffscreenMap::OffscreenMap(const Maze* maze, const QSize& size) :
+        m_maze(maze),
+        m_size(size),
+        m_textureAtlas(FontImage::get()->imageFilePath()) {
+
+    ASSERT_FA(m_maze == nullptr);
+    ASSERT_LT(0, m_size.width());
+    ASSERT_LT(0, m_size.height());
+
+    // Mirrors TransformationMatrix::getFullMapTransformationMatrix: the
+    // physical point (0,0) is the middle of the bottom-left corner piece, the
+    // maze is scaled uniformly to fit, centered, and y points up
+    double wallWidth = P()->wallWidth();
+    double tileLength = P()->wallLength() + P()->wallWidth();
+    double physicalWidth = wallWidth + m_maze->getWidth() * tileLength;
+    double physicalHeight = wallWidth + m_maze->getHeight() * tileLength;
+    double pixelsPerMeter = std::min(
+        m_size.width() / physicalWidth,
+        m_size.height() / physicalHeight);
+    double marginX = 0.5 * (m_size.width() - pixelsPerMeter * physicalWidth);
+    double marginY = 0.5 * (m_size.height() - pixelsPerMeter * physicalHeight);
+    m_transform.translate(marginX, m_size.height() - marginY);
+    m_transform.scale(pixelsPerMeter, -pixelsPerMeter);
+    m_transform.translate(0.5 * wallWidth, 0.5 * wallWidth);
+}
+
+QImage OffscreenMap::render(
+        const MazeView* view,
+        const MouseGraphic* mouseGraphic) const {
+
+    QImage image(m_size, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::black);
+    if (view == nullptr) {
+        return image;
+    }
+
+    // Antialiasing would cost more than the rest of the frame combined
+    QPainter painter(&image);
+    painter.setPen(Qt::NoPen);
+
+    // Draw the tiles
+    drawTiles(
+        &painter,
+        *view->getMazeGeometry()->getPositions(),
+        *view->getGraphicCpuBuffer());
+
+    // Overlay the tile text
+    drawTextures(&painter, *view->getTextureCpuBuffer());
+
+    // Draw the mouse, then the sensor views on top of it
+    if (mouseGraphic != nullptr) {
+        auto currentPosition = mouseGraphic->getCurrentMousePosition();
+        QMatrix4x4 pose = mouseGraphic->getPoseMatrix(
+            currentPosition.first,
+            currentPosition.second);
+        const QVector<TriangleGraphic>& mesh = mouseGraphic->getStaticMesh();
+        drawTriangles(
+            &painter,
+            mesh.constData(),
+            mesh.size(),
+            pose.toTransform() * m_transform);
+        QVector<TriangleGraphic> views = mouseGraphic->drawSensorViews(
+            currentPosition.first,
+            currentPosition.second);
+        drawTriangles(&painter, views.constData(), views.size(), m_transform);
+    }
+
+    painter.end();
+    return image;
+}
+
+void OffscreenMap::drawTiles(
+        QPainter* painter,
+        const QVector<TrianglePosition>& positions,
+        const QVector<TriangleColor>& colors) const {
+
+    // The positions are shared by all views, the colors belong to this one
+    ASSERT_EQ(positions.size(), colors.size());
+    QPolygonF polygon(3);
+    painter->setTransform(m_transform);
+    for (int i = 0; i < positions.size(); i += 1) {
+        const TrianglePosition& p = positions.at(i);
+        const TriangleColor& c = colors.at(i);
+        // All vertices of a triangle share a color
+        if (c.p1.a <= 0.0) {
+            continue;
+        }
+        polygon[0] = QPointF(p.p1.x, p.p1.y);
+        polygon[1] = QPointF(p.p2.x, p.p2.y);
+        polygon[2] = QPointF(p.p3.x, p.p3.y);
+        painter->setBrush(QColor::fromRgbF(
+            c.p1.rgb.r, c.p1.rgb.g, c.p1.rgb.b, std::min(c.p1.a, 1.0)));
+        painter->drawConvexPolygon(polygon);
+    }
+    painter->resetTransform();
+}
+
+void OffscreenMap::drawTriangles(
+        QPainter* painter,
+        const TriangleGraphic* triangles,
+        int count,
+        const QTransform& transform) const {
+
+    // Reuse a single polygon to avoid an allocation per triangle
+    QPolygonF polygon(3);
+    painter->setTransform(transform);
+    for (int i = 0; i < count; i += 1) {
+        const TriangleGraphic& t = triangles[i];
+        // All vertices of a triangle share a color
+        if (t.p1.a <= 0.0) {
+            continue;
+        }
+        polygon[0] = QPointF(t.p1.x, t.p1.y);
+        polygon[1] = QPointF(t.p2.x, t.p2.y);
+        polygon[2] = QPointF(t.p3.x, t.p3.y);
+        painter->setBrush(QColor::fromRgbF(
+            t.p1.rgb.r, t.p1.rgb.g, t.p1.rgb.b, std::min(t.p1.a, 1.0)));
+        painter->drawConvexPolygon(polygon);
+    }
+    painter->resetTransform();
+}
+
+void OffscreenMap::drawTextures(
+        QPainter* painter,
+        const QVector<TriangleTexture>& textures) const {
+
+    // BufferInterface writes each character as an axis-aligned quad made of
+    // two consecutive triangles, so we can blit it as a single image rect.
+    // This is done in device coordinates so that the glyphs aren't flipped.
+    double atlasWidth = m_textureAtlas.width();
+    double atlasHeight = m_textureAtlas.height();
+    for (int i = 0; i + 1 < textures.size(); i += 2) {
+        const VertexTexture* vertices[6] = {
+            &textures.at(i).p1, &textures.at(i).p2, &textures.at(i).p3,
+            &textures.at(i + 1).p1, &textures.at(i + 1).p2, &textures.at(i + 1).p3,
+        };
+        double minX = vertices[0]->x;
+        double maxX = vertices[0]->x;
+        double minY = vertices[0]->y;
+        double maxY = vertices[0]->y;
+        double minU = vertices[0]->u;
+        double maxU = vertices[0]->u;
+        double minV = vertices[0]->v;
+        double maxV = vertices[0]->v;
+        for (int j = 1; j < 6; j += 1) {
+            minX = std::min(minX, vertices[j]->x);
+            maxX = std::max(maxX, vertices[j]->x);
+            minY = std::min(minY, vertices[j]->y);
+            maxY = std::max(maxY, vertices[j]->y);
+            minU = std::min(minU, vertices[j]->u);
+            maxU = std::max(maxU, vertices[j]->u);
+            minV = std::min(minV, vertices[j]->v);
+            maxV = std::max(maxV, vertices[j]->v);
+        }
+        if (maxX <= minX || maxY <= minY || maxU <= minU) {
+            continue;
+        }
+        // The GL texture is mirrored, so v is measured from the bottom
+        QRectF target = m_transform.mapRect(
+            QRectF(minX, minY, maxX - minX, maxY - minY));
+        QRectF source(
+            minU * atlasWidth,
+            (1.0 - maxV) * atlasHeight,
+            (maxU - minU) * atlasWidth,
+            (maxV - minV) * atlasHeight);
+        painter->drawImage(target, m_textureAtlas, source);
+    }
+}
+
+} // namespace mms
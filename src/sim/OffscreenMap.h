@@ -0,0 +1,61 @@
+#pragma once
+
+#include <QImage>
+#include <QSize>
+#include <QTransform>
+#include <QVector>
+
+#include "Maze.h"
+#include "MazeGeometry.h"
+#include "MazeView.h"
+#include "MouseGraphic.h"
+#include "TriangleColor.h"
+#include "TriangleGraphic.h"
+#include "TrianglePosition.h"
+#include "TriangleTexture.h"
+
+namespace mms {
+
+// A software rasterizer over the same buffers that Map uploads to the GPU.
+// It only needs QImage and QPainter, so it works without a display (e.g.,
+// with QT_QPA_PLATFORM=offscreen) and never touches an OpenGL context.
+class OffscreenMap {
+
+public:
+
+    OffscreenMap(const Maze* maze, const QSize& size);
+
+    // Renders the full map layout of the given view, and optionally the mouse
+    QImage render(
+        const MazeView* view,
+        const MouseGraphic* mouseGraphic) const;
+
+private:
+
+    // No ownership here - only pointers
+    const Maze* m_maze;
+
+    // The output image size and the meters-to-pixels transform
+    QSize m_size;
+    QTransform m_transform;
+
+    // The font atlas, in QImage (top-to-bottom) orientation
+    QImage m_textureAtlas;
+
+    // Drawing helper methods
+    void drawTiles(
+        QPainter* painter,
+        const QVector<TrianglePosition>& positions,
+        const QVector<TriangleColor>& colors) const;
+    void drawTriangles(
+        QPainter* painter,
+        const TriangleGraphic* triangles,
+        int count,
+        const QTransform& transform) const;
+    void drawTextures(
+        QPainter* painter,
+        const QVector<TriangleTexture>& textures) const;
+
+};
+
+} // namespace mms
@@ -2,6 +2,7 @@
 
 #include "Color.h"
 #include "Direction.h"
+#include "IntegratorType.h"
 #include "LayoutType.h"
 #include "Logging.h"
 #include "MazeFileType.h"
@@ -88,6 +89,18 @@ Param::Param() {
     m_distanceCorrectTileBaseColor = ParamParser::getStringIfHasStringAndIsColor(
         "distance-correct-tile-base-color", COLOR_TO_STRING().value(Color::DARK_YELLOW));
 
+    // Offscreen Frame Export Parameters
+    m_frameExportDirectory = ParamParser::getStringIfHasString(
+        "frame-export-directory", "");
+    m_frameExportInterval = ParamParser::getDoubleIfHasDoubleAndInRange(
+        "frame-export-interval", 0.0, 0.0, 60.0);
+    m_frameExportBudget = ParamParser::getDoubleIfHasDoubleAndInRange(
+        "frame-export-budget", 20.0, 1.0, 1000.0);
+    m_frameExportWidth = ParamParser::getIntIfHasIntAndInRange(
+        "frame-export-width", 800, 64, 4096);
+    m_frameExportHeight = ParamParser::getIntIfHasIntAndInRange(
+        "frame-export-height", 800, 64, 4096);
+
     // Simulation Parameters
     bool useRandomSeed = ParamParser::getBoolIfHasBool(
         "use-random-seed", false);
@@ -124,6 +137,16 @@ Param::Param() {
         "number-of-circle-approximation-points", 8, 3, 30);
     m_numberOfSensorEdgePoints = ParamParser::getIntIfHasIntAndInRange(
         "number-of-sensor-edge-points", 3, 2, 10);
+    m_sensorTableDirectory = ParamParser::getStringIfHasString(
+        "sensor-table-directory", "");
+    m_sensorTablePositionResolution = ParamParser::getDoubleIfHasDoubleAndInRange(
+        "sensor-table-position-resolution", 0.01, 0.001, 0.05);
+    m_sensorTableRotationResolution = ParamParser::getDoubleIfHasDoubleAndInRange(
+        "sensor-table-rotation-resolution", 5.0, 0.5, 45.0);
+    m_timeStep = ParamParser::getDoubleIfHasDoubleAndInRange(
+        "time-step", 0.001, 0.0001, 0.02);
+    m_integratorType = ParamParser::getStringIfHasStringAndIsIntegratorType(
+        "integrator-type", INTEGRATOR_TYPE_TO_STRING().value(IntegratorType::ARC));
 
     // Maze Parameters
     m_wallWidth = ParamParser::getDoubleIfHasDoubleAndInRange(
@@ -134,6 +157,12 @@ Param::Param() {
         "maze-mirrored", false);
     m_mazeRotations = ParamParser::getIntIfHasIntAndInRange(
         "maze-rotations", 0, 0, 3);
+    m_saveGeneratedMaze = ParamParser::getBoolIfHasBool(
+        "save-generated-maze", false);
+    m_generatedMazeFile = ParamParser::getStringIfHasString(
+        "generated-maze-file", "generated_maze");
+    m_generatedMazeType = ParamParser::getStringIfHasStringAndIsMazeFileType(
+        "generated-maze-type", MAZE_FILE_TYPE_TO_STRING().value(MazeFileType::NUM));
 }
 
 int Param::defaultWindowWidth() {
@@ -216,6 +245,26 @@ QString Param::distanceCorrectTileBaseColor() {
     return m_distanceCorrectTileBaseColor;
 }
 
+QString Param::frameExportDirectory() {
+    return m_frameExportDirectory;
+}
+
+double Param::frameExportInterval() {
+    return m_frameExportInterval;
+}
+
+double Param::frameExportBudget() {
+    return m_frameExportBudget;
+}
+
+int Param::frameExportWidth() {
+    return m_frameExportWidth;
+}
+
+int Param::frameExportHeight() {
+    return m_frameExportHeight;
+}
+
 int Param::randomSeed() {
     return m_randomSeed;
 }
@@ -244,6 +293,26 @@ int Param::numberOfSensorEdgePoints() {
     return m_numberOfSensorEdgePoints;
 }
 
+QString Param::sensorTableDirectory() {
+    return m_sensorTableDirectory;
+}
+
+double Param::sensorTablePositionResolution() {
+    return m_sensorTablePositionResolution;
+}
+
+double Param::sensorTableRotationResolution() {
+    return m_sensorTableRotationResolution;
+}
+
+double Param::timeStep() {
+    return m_timeStep;
+}
+
+QString Param::integratorType() {
+    return m_integratorType;
+}
+
 double Param::wallWidth() {
     return m_wallWidth;
 }
@@ -260,4 +329,16 @@ int Param::mazeRotations() {
     return m_mazeRotations;
 }
 
+bool Param::saveGeneratedMaze() {
+    return m_saveGeneratedMaze;
+}
+
+QString Param::generatedMazeFile() {
+    return m_generatedMazeFile;
+}
+
+QString Param::generatedMazeType() {
+    return m_generatedMazeType;
+}
+
 } // namespace mms
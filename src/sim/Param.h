@@ -47,6 +47,13 @@ public:
     double tileFogAlpha();
     QString distanceCorrectTileBaseColor();
 
+    // Offscreen frame export parameters
+    QString frameExportDirectory();
+    double frameExportInterval();
+    double frameExportBudget();
+    int frameExportWidth();
+    int frameExportHeight();
+
     // Simulation parameters
     int randomSeed();
     // bool defaultPaused();
@@ -62,12 +69,20 @@ public:
     // bool printLateCollisionDetections();
     int numberOfCircleApproximationPoints();
     int numberOfSensorEdgePoints();
+    QString sensorTableDirectory();
+    double sensorTablePositionResolution();
+    double sensorTableRotationResolution();
+    double timeStep();
+    QString integratorType();
 
     // Maze parameters
     double wallWidth();
     double wallLength();
     bool mazeMirrored();
     int mazeRotations();
+    bool saveGeneratedMaze();
+    QString generatedMazeFile();
+    QString generatedMazeType();
 
 private:
 
@@ -109,6 +124,13 @@ private:
     double m_tileFogAlpha;
     QString m_distanceCorrectTileBaseColor;
 
+    // Offscreen frame export parameters
+    QString m_frameExportDirectory;
+    double m_frameExportInterval;
+    double m_frameExportBudget;
+    int m_frameExportWidth;
+    int m_frameExportHeight;
+
     // Simulation parameters
     int m_randomSeed;
     bool m_defaultPaused;
@@ -124,12 +146,20 @@ private:
     bool m_printLateCollisionDetections;
     int m_numberOfCircleApproximationPoints;
     int m_numberOfSensorEdgePoints;
+    QString m_sensorTableDirectory;
+    double m_sensorTablePositionResolution;
+    double m_sensorTableRotationResolution;
+    double m_timeStep;
+    QString m_integratorType;
 
     // Maze parameters
     double m_wallWidth;
     double m_wallLength;
     bool m_mazeMirrored;
     int m_mazeRotations;
+    bool m_saveGeneratedMaze;
+    QString m_generatedMazeFile;
+    QString m_generatedMazeType;
 };
 
 } // namespace mms
@@ -5,6 +5,7 @@
 #include "ConfigDialog.h"
 #include "ConfigDialogField.h"
 #include "Direction.h"
+#include "IntegratorType.h"
 #include "LayoutType.h"
 #include "Logging.h"
 #include "MazeFileType.h"
@@ -178,6 +179,10 @@ QString ParamParser::getStringIfHasStringAndIsDirection(const QString& tag, cons
     return getStringIfHasStringAndIsSpecial("direction", tag, defaultValue, STRING_TO_DIRECTION());
 }
 
+QString ParamParser::getStringIfHasStringAndIsIntegratorType(const QString& tag, const QString& defaultValue) {
+    return getStringIfHasStringAndIsSpecial("integrator type", tag, defaultValue, STRING_TO_INTEGRATOR_TYPE());
+}
+
 QString ParamParser::getStringIfHasStringAndIsLayoutType(const QString& tag, const QString& defaultValue) {
     return getStringIfHasStringAndIsSpecial("layout type", tag, defaultValue, STRING_TO_LAYOUT_TYPE());
 }
@@ -3,137 +3,110 @@
 #include <QtMath>
 
 #include "Assert.h"
-#include "GeometryUtilities.h"
-#include "SimUtilities.h"
+#include "TransformedPolygon.h"
 #include "polypartition/polypartition.h"
 
 namespace mms {
 
-Polygon::Polygon() {
+Polygon::Polygon() : m_data(std::make_shared<Data>()) {
 }
 
-Polygon::Polygon(const Polygon& polygon) :
-    m_vertices(polygon.getVertices()) {
-    // If the polygon being copyed has already been triangulated, we should
-    // grab the triangles, lest we have to re-triangulate in the future. If not,
-    // we can be lazy, in case the triangles for this polygon aren't needed.
-    if (polygon.alreadyPerformedTriangulation()) {
-        m_triangles = polygon.getTriangles();
-    }
-    else {
-        // Uncomment to log untriangulated polygon copies
-        /*
-        static int i = 0;
-        i += 1;
-        if (i % 100 == 0) {
-            qInfo().noquote().nospace()
-                << "Untriangulated polygon copies count: %v", i);
-        }
-        */
+Polygon::Polygon(const QVector<Coordinate>& vertices) {
+    ASSERT_LE(3, vertices.size());
+    std::shared_ptr<Data> data = std::make_shared<Data>();
+    data->xs.reserve(vertices.size());
+    data->ys.reserve(vertices.size());
+    for (const Coordinate& vertex : vertices) {
+        data->xs.append(vertex.getX().getMeters());
+        data->ys.append(vertex.getY().getMeters());
     }
+    m_data = data;
 }
 
-Polygon::Polygon(QVector<Coordinate> vertices) :
-    m_vertices(vertices),
-    // Postpone triangulation until we absolutely have to do it.
-    m_triangles({}) {
-    ASSERT_LE(3, m_vertices.size());
-    // If the number of vertices is three, the triangulation is trivial
-    if (m_vertices.size() == 3) {
-        m_triangles = {{
-            m_vertices.at(0),
-            m_vertices.at(1),
-            m_vertices.at(2),
-        }};
-    }
+int Polygon::size() const {
+    return m_data->xs.size();
 }
 
-QVector<Coordinate> Polygon::getVertices() const {
-    return m_vertices;
+double Polygon::getX(int index) const {
+    return m_data->xs.at(index);
 }
 
-QVector<Triangle> Polygon::getTriangles() const {
-    // Lazy initialization here
-    if (m_triangles.size() == 0) {
-        m_triangles = triangulate(m_vertices);
-    }
-    return m_triangles;
+double Polygon::getY(int index) const {
+    return m_data->ys.at(index);
 }
 
-Area Polygon::area() const {
-
-    // See http://mathmodel.wolfram.com/PolygonArea.html
-
-    double sumOfDeterminants = 0.0;
-    for (int i = 0; i < m_vertices.size(); i += 1) {
-        int j = (i + 1) % m_vertices.size();
-        sumOfDeterminants += (
-            m_vertices.at(i).getX().getMeters() *
-            m_vertices.at(j).getY().getMeters()
-        );
-        sumOfDeterminants -= (
-            m_vertices.at(i).getY().getMeters() *
-            m_vertices.at(j).getX().getMeters()
-        );
+QVector<Coordinate> Polygon::getVertices() const {
+    QVector<Coordinate> vertices;
+    vertices.reserve(size());
+    for (int i = 0; i < size(); i += 1) {
+        vertices.append(Coordinate::Cartesian(
+            Distance::Meters(getX(i)),
+            Distance::Meters(getY(i))));
     }
-    return Area::MetersSquared(std::abs(sumOfDeterminants / 2.0));
+    return vertices;
 }
 
-Polygon Polygon::translate(const Coordinate& translation) const {
-
-    QVector<Coordinate> vertices;
-    for (const Coordinate& vertex : m_vertices) {
-        vertices.push_back(GeometryUtilities::translateVertex(vertex, translation));
-    }
+const QVector<int>& Polygon::getTriangulation() const {
+    const Data* data = m_data.get();
+    std::call_once(data->triangulated, [data]() {
+        // If the number of vertices is three, the triangulation is trivial
+        if (data->xs.size() == 3) {
+            data->triangulation = {0, 1, 2};
+        }
+        else if (3 < data->xs.size()) {
+            data->triangulation = triangulate(data->xs, data->ys);
+        }
+    });
+    return data->triangulation;
+}
 
+QVector<Triangle> Polygon::getTriangles() const {
+    const QVector<int>& triangulation = getTriangulation();
     QVector<Triangle> triangles;
-    for (const Triangle& triangle : m_triangles) {
-        triangles.push_back({
-            GeometryUtilities::translateVertex(triangle.p1, translation),
-            GeometryUtilities::translateVertex(triangle.p2, translation),
-            GeometryUtilities::translateVertex(triangle.p3, translation),
+    triangles.reserve(triangulation.size() / 3);
+    for (int i = 0; i + 2 < triangulation.size(); i += 3) {
+        triangles.append({
+            Coordinate::Cartesian(
+                Distance::Meters(getX(triangulation.at(i))),
+                Distance::Meters(getY(triangulation.at(i)))),
+            Coordinate::Cartesian(
+                Distance::Meters(getX(triangulation.at(i + 1))),
+                Distance::Meters(getY(triangulation.at(i + 1)))),
+            Coordinate::Cartesian(
+                Distance::Meters(getX(triangulation.at(i + 2))),
+                Distance::Meters(getY(triangulation.at(i + 2)))),
         });
     }
-
-    return Polygon(vertices, triangles);
+    return triangles;
 }
 
-Polygon Polygon::rotateAroundPoint(const Angle& angle, const Coordinate& point) const {
+Area Polygon::area() const {
 
-    QVector<Coordinate> vertices;
-    for (const Coordinate& vertex : m_vertices) {
-        vertices.push_back(GeometryUtilities::rotateVertexAroundPoint(vertex, angle, point));
-    }
+    // See http://mathmodel.wolfram.com/PolygonArea.html
 
-    QVector<Triangle> triangles;
-    for (const Triangle& triangle : m_triangles) {
-        triangles.push_back({
-            GeometryUtilities::rotateVertexAroundPoint(triangle.p1, angle, point),
-            GeometryUtilities::rotateVertexAroundPoint(triangle.p2, angle, point),
-            GeometryUtilities::rotateVertexAroundPoint(triangle.p3, angle, point),
-        });
+    const QVector<double>& xs = m_data->xs;
+    const QVector<double>& ys = m_data->ys;
+    double sumOfDeterminants = 0.0;
+    for (int i = 0; i < xs.size(); i += 1) {
+        int j = (i + 1) % xs.size();
+        sumOfDeterminants += xs.at(i) * ys.at(j);
+        sumOfDeterminants -= ys.at(i) * xs.at(j);
     }
-
-    return Polygon(vertices, triangles);
-}
-
-Polygon::Polygon(QVector<Coordinate> vertices, QVector<Triangle> triangles) :
-    m_vertices(vertices),
-    m_triangles(triangles) {
+    return Area::MetersSquared(std::abs(sumOfDeterminants / 2.0));
 }
 
-bool Polygon::alreadyPerformedTriangulation() const {
-    return 0 < m_triangles.size();
+TransformedPolygon Polygon::transformed(const AffineTransform& transform) const {
+    return TransformedPolygon(*this, transform);
 }
 
-QVector<Triangle> Polygon::triangulate(QVector<Coordinate> vertices) {
+QVector<int> Polygon::triangulate(const QVector<double>& xs, const QVector<double>& ys) {
 
     // Populate the TPPLPoly
     TPPLPoly tpplPoly;
-    tpplPoly.Init(vertices.size());
-    for (int i = 0; i < vertices.size(); i += 1) {
-        tpplPoly[i].x = vertices.at(i).getX().getMeters();
-        tpplPoly[i].y = vertices.at(i).getY().getMeters();
+    tpplPoly.Init(xs.size());
+    for (int i = 0; i < xs.size(); i += 1) {
+        tpplPoly[i].x = xs.at(i);
+        tpplPoly[i].y = ys.at(i);
     }
     tpplPoly.SetOrientation(TPPL_CCW);
 
@@ -142,17 +115,23 @@ QVector<Triangle> Polygon::triangulate(QVector<Coordinate> vertices) {
     std::list<TPPLPoly> result;
     triangulator.Triangulate_EC(&tpplPoly, &result);
 
-    // Populate the output vector
-    QVector<Triangle> triangles;
+    // The triangles are made of copies of the input points, so we can map
+    // them back to the indices of the vertices with exact comparisons
+    QVector<int> triangulation;
     for (auto it = result.begin(); it != result.end(); it++) {
-        triangles.push_back({
-            Coordinate::Cartesian(Distance::Meters((*it)[0].x), Distance::Meters((*it)[0].y)),
-            Coordinate::Cartesian(Distance::Meters((*it)[1].x), Distance::Meters((*it)[1].y)),
-            Coordinate::Cartesian(Distance::Meters((*it)[2].x), Distance::Meters((*it)[2].y)),
-        });
+        for (int corner = 0; corner < 3; corner += 1) {
+            int index = 0;
+            while (
+                index < xs.size() - 1 &&
+                !(xs.at(index) == (*it)[corner].x && ys.at(index) == (*it)[corner].y)
+            ) {
+                index += 1;
+            }
+            triangulation.append(index);
+        }
     }
 
-    return triangles;
+    return triangulation;
 }
 
 } // namespace mms
@@ -2,6 +2,10 @@
 
 #include <QVector>
 
+#include <memory>
+#include <mutex>
+
+#include "AffineTransform.h"
 #include "Triangle.h"
 #include "units/Angle.h"
 #include "units/Area.h"
@@ -9,44 +13,54 @@
 
 namespace mms {
 
+class TransformedPolygon;
+
+// An immutable simple polygon. The vertices are stored as separate x and y
+// arrays, and the triangulation is stored as indices into them, so that both
+// can be mapped through a transformation without being copied first. All
+// copies of a polygon (and all transformed views of it, see
+// TransformedPolygon) share the same data, so copying is cheap and the
+// polygon is triangulated at most once, no matter how it's moved around.
 class Polygon {
 
 public:
 
     Polygon();
-    Polygon(const Polygon& polygon);
-    Polygon(QVector<Coordinate> vertices);
+    Polygon(const QVector<Coordinate>& vertices);
 
+    // The vertices, in meters
+    int size() const;
+    double getX(int index) const;
+    double getY(int index) const;
     QVector<Coordinate> getVertices() const;
+
+    // The triangulation, as consecutive triples of vertex indices. We're lazy
+    // about triangulation, since it's expensive and not always necessary, so
+    // it's performed on first use (from any thread) and then kept.
+    const QVector<int>& getTriangulation() const;
     QVector<Triangle> getTriangles() const;
 
     Area area() const;
 
-    Polygon translate(const Coordinate& translation) const;
-    Polygon rotateAroundPoint(const Angle& angle, const Coordinate& point) const;
+    // A view of this polygon with the transformation applied to it
+    TransformedPolygon transformed(const AffineTransform& transform) const;
 
 private:
 
-    QVector<Coordinate> m_vertices;
-
-    // We're lazy about triangulation, since it's expensive and not always
-    // necessary. The "mutable" keyword allows us to assign m_triangles in the
-    // const function getTriangles().
-    mutable QVector<Triangle> m_triangles;
-
-    // This special constructor makes it so that rotate and translate don't
-    // require re-triangulation. We keep it private since it's pretty easy to
-    // abuse the fact that the triangles argument should be the triangulation
-    // of the polygon specified by the vertices argument.
-    Polygon(QVector<Coordinate> vertices, QVector<Triangle> triangles);
+    // Makes it possible for TransformedPolygon::toPolygon() to reuse the
+    // triangulation, since transformations don't change the vertex order
+    friend class TransformedPolygon;
 
-    // Tells us whether or not the polygon has already performed triangulation.
-    // This is used in the copy constructor, and allows us to be lazy without
-    // throwing away information.
-    bool alreadyPerformedTriangulation() const;
+    struct Data {
+        QVector<double> xs;
+        QVector<double> ys;
+        mutable std::once_flag triangulated;
+        mutable QVector<int> triangulation;
+    };
+    std::shared_ptr<const Data> m_data;
 
     // Actually peforms the triangulation of the polygon.
-    static QVector<Triangle> triangulate(QVector<Coordinate> vertices);
+    static QVector<int> triangulate(const QVector<double>& xs, const QVector<double>& ys);
 
 };
 
@@ -0,0 +1,143 @@
+#include "PoseIntegrator.h"
+
+#include <QtMath>
+
+#include "units/Distance.h"
+
+#include "Assert.h"
+
+namespace mms {
+
+QPair<Coordinate, Angle> PoseIntegrator::integrate(
+        IntegratorType integratorType,
+        const Coordinate& translation,
+        const Rotation& rotation,
+        const WheelEffect& start,
+        const WheelEffect& end,
+        const Duration& elapsed) {
+
+    // NOTE: This is a performance critical function
+
+    double dt = elapsed.getSeconds();
+    Velocity startVelocity = toVelocity(start);
+    Velocity endVelocity = toVelocity(end);
+    switch (integratorType) {
+        case IntegratorType::EULER:
+            return euler(translation, rotation, startVelocity, dt);
+        case IntegratorType::ARC:
+            return arc(translation, rotation,
+                interpolate(startVelocity, endVelocity, 0.5), dt);
+        case IntegratorType::RK4:
+            return rk4(translation, rotation, startVelocity, endVelocity, dt);
+    }
+    ASSERT_NEVER_RUNS();
+    return euler(translation, rotation, startVelocity, dt);
+}
+
+PoseIntegrator::Velocity PoseIntegrator::toVelocity(const WheelEffect& effect) {
+    return {
+        effect.forwardEffect.getMetersPerSecond(),
+        effect.sidewaysEffect.getMetersPerSecond(),
+        effect.turnEffect.getRadiansPerSecond(),
+    };
+}
+
+PoseIntegrator::Velocity PoseIntegrator::interpolate(
+        const Velocity& start,
+        const Velocity& end,
+        double fraction) {
+    return {
+        start.forward + (end.forward - start.forward) * fraction,
+        start.sideways + (end.sideways - start.sideways) * fraction,
+        start.turn + (end.turn - start.turn) * fraction,
+    };
+}
+
+QPair<Coordinate, Angle> PoseIntegrator::euler(
+        const Coordinate& translation,
+        const Rotation& rotation,
+        const Velocity& velocity,
+        double dt) {
+    double dx = velocity.forward * rotation.getCos() + velocity.sideways * rotation.getSin();
+    double dy = velocity.forward * rotation.getSin() - velocity.sideways * rotation.getCos();
+    return {
+        translation + Coordinate::Cartesian(
+            Distance::Meters(dx * dt),
+            Distance::Meters(dy * dt)),
+        rotation.getAngle() + Angle::Radians(velocity.turn * dt),
+    };
+}
+
+QPair<Coordinate, Angle> PoseIntegrator::arc(
+        const Coordinate& translation,
+        const Rotation& rotation,
+        const Velocity& velocity,
+        double dt) {
+
+    // Integrating the velocity, rotated by turn * t, over the step gives a
+    // displacement (in the frame of the mouse at the start of the step) of
+    // dt * [S -C; C S] * [forward; -sideways], where S = sin(phi) / phi and
+    // C = (1 - cos(phi)) / phi, with phi = turn * dt. For small phi we use the
+    // Taylor series instead, to avoid dividing by (nearly) zero.
+    double phi = velocity.turn * dt;
+    double S;
+    double C;
+    if (std::abs(phi) < 1e-4) {
+        S = 1.0 - phi * phi / 6.0;
+        C = phi / 2.0 - phi * phi * phi / 24.0;
+    }
+    else {
+        S = std::sin(phi) / phi;
+        C = (1.0 - std::cos(phi)) / phi;
+    }
+    double forward = dt * (S * velocity.forward + C * velocity.sideways);
+    double left = dt * (C * velocity.forward - S * velocity.sideways);
+    return {
+        translation + rotation.rotate(Coordinate::Cartesian(
+            Distance::Meters(forward),
+            Distance::Meters(left))),
+        rotation.getAngle() + Angle::Radians(phi),
+    };
+}
+
+QPair<Coordinate, Angle> PoseIntegrator::rk4(
+        const Coordinate& translation,
+        const Rotation& rotation,
+        const Velocity& start,
+        const Velocity& end,
+        double dt) {
+
+    // The state is (x, y, theta), but the derivative depends only on theta
+    // (and time), so we only need to track the rotation at each stage
+    Velocity middle = interpolate(start, end, 0.5);
+    auto derivative = [](const Velocity& velocity, double sin, double cos, double* d) {
+        d[0] = velocity.forward * cos + velocity.sideways * sin;
+        d[1] = velocity.forward * sin - velocity.sideways * cos;
+        d[2] = velocity.turn;
+    };
+    double theta = rotation.getAngle().getRadiansUnbounded();
+    double k1[3];
+    double k2[3];
+    double k3[3];
+    double k4[3];
+    derivative(start, rotation.getSin(), rotation.getCos(), k1);
+    double theta2 = theta + k1[2] * dt / 2.0;
+    derivative(middle, std::sin(theta2), std::cos(theta2), k2);
+    double theta3 = theta + k2[2] * dt / 2.0;
+    derivative(middle, std::sin(theta3), std::cos(theta3), k3);
+    double theta4 = theta + k3[2] * dt;
+    derivative(end, std::sin(theta4), std::cos(theta4), k4);
+
+    double d[3];
+    for (int i = 0; i < 3; i += 1) {
+        d[i] = dt / 6.0 * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+    }
+    return {
+        translation + Coordinate::Cartesian(
+            Distance::Meters(d[0]),
+            Distance::Meters(d[1])),
+        rotation.getAngle() + Angle::Radians(d[2]),
+    };
+}
+
+} // namespace mms
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <QPair>
+
+#include "units/Angle.h"
+#include "units/Coordinate.h"
+#include "units/Duration.h"
+#include "units/Rotation.h"
+
+#include "IntegratorType.h"
+#include "WheelEffect.h"
+
+namespace mms {
+
+// Advances the pose (translation and rotation) of the mouse over one step,
+// given its velocity in its own frame of reference (as a WheelEffect, i.e.,
+// forward speed, sideways speed to the right, and rate of rotation) at the
+// start and the end of the step, which is assumed to change linearly between
+// the two. The integrators are:
+//
+// - EULER: Samples the rotation at the start of the step, so that arcs are
+//   only accurate if the step is very small
+// - ARC: Follows the circular arc (or straight line) that results from moving
+//   at the velocity at the midpoint of the step, which is exact if the
+//   velocity doesn't change during the step, no matter how large the step
+// - RK4: The classic fourth order Runge-Kutta method, which is very accurate
+//   even if the velocity does change during the step
+class PoseIntegrator {
+
+public:
+
+    // The PoseIntegrator class is not constructible
+    PoseIntegrator() = delete;
+
+    // Returns the translation and rotation at the end of the step
+    static QPair<Coordinate, Angle> integrate(
+        IntegratorType integratorType,
+        const Coordinate& translation,
+        const Rotation& rotation,
+        const WheelEffect& start,
+        const WheelEffect& end,
+        const Duration& elapsed);
+
+private:
+
+    // The velocity of the mouse, in its own frame of reference
+    struct Velocity {
+        double forward;
+        double sideways;
+        double turn;
+    };
+
+    static Velocity toVelocity(const WheelEffect& effect);
+    static Velocity interpolate(const Velocity& start, const Velocity& end, double fraction);
+
+    static QPair<Coordinate, Angle> euler(
+        const Coordinate& translation,
+        const Rotation& rotation,
+        const Velocity& velocity,
+        double dt);
+
+    static QPair<Coordinate, Angle> arc(
+        const Coordinate& translation,
+        const Rotation& rotation,
+        const Velocity& velocity,
+        double dt);
+
+    static QPair<Coordinate, Angle> rk4(
+        const Coordinate& translation,
+        const Rotation& rotation,
+        const Velocity& start,
+        const Velocity& end,
+        double dt);
+
+};
+
+} // namespace mms
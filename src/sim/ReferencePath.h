@@ -0,0 +1,20 @@
+#pragma once
+
+#include <QStringList>
+
+#include "units/Duration.h"
+
+namespace mms {
+
+// The fastest way for a particular mouse to get from the origin to the center
+// of a particular maze, using the tile edge movements of MouseInterface
+struct ReferencePath {
+    bool isReachable = false;
+    // Measured like MouseStats::bestTimeToCenter, i.e., from origin departure
+    Duration timeToCenter = Duration::Seconds(-1);
+    // The movement commands, e.g., "moveForwardToEdge(3)", after leaving the
+    // origin (via originMoveForwardToEdge, with any turns in place before it)
+    QStringList moves;
+};
+
+} // namespace mms
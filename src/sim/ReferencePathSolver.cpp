@@ -0,0 +1,188 @@
+#include "ReferencePathSolver.h"
+
+#include <QVector>
+#include <QtMath>
+
+#include <functional>
+#include <limits>
+#include <queue>
+
+#include "units/Distance.h"
+
+#include "MovementPrimitive.h"
+#include "Param.h"
+
+namespace mms {
+
+ReferencePath ReferencePathSolver::solve(
+        const Maze* maze,
+        const Mouse* mouse,
+        double wheelSpeedFraction) {
+
+    ReferencePath path;
+    const BasicMaze& walls = maze->getWalls();
+    if (walls.isEmpty()) {
+        return path;
+    }
+
+    // The speeds of the movements, as set by MouseInterface; note that turns
+    // in place are performed at half speed
+    double halfWallLength = P()->wallLength() / 2.0;
+    double wallWidth = P()->wallWidth();
+    double tileLength = P()->wallLength() + P()->wallWidth();
+    double forwardSpeed = mouse->getPrimitiveVelocity(
+        MovementPrimitive::FORWARD,
+        wheelSpeedFraction).first.getMetersPerSecond();
+    double curveRate = std::abs(mouse->getPrimitiveVelocity(
+        MovementPrimitive::CURVE_LEFT,
+        wheelSpeedFraction).second.getRadiansPerSecond());
+    double turnRate = std::abs(mouse->getPrimitiveVelocity(
+        MovementPrimitive::TURN_LEFT,
+        0.5 * wheelSpeedFraction).second.getRadiansPerSecond());
+    if (forwardSpeed <= 0.0 || curveRate <= 0.0 || turnRate <= 0.0) {
+        return path;
+    }
+
+    // The costs of the fixed movements, in seconds
+    double forwardCost = tileLength / forwardSpeed;
+    double curveCost = (M_PI / 2.0) / curveRate + wallWidth / forwardSpeed;
+    double turnAroundCost =
+        (2.0 * halfWallLength + wallWidth) / forwardSpeed + M_PI / turnRate;
+
+    // A diagonal of n segments backs up to the edge of the tile, turns in
+    // place toward a point n half tile diagonals away, drives there, turns in
+    // place to the exit heading, and then drives half a wall width forward
+    auto diagonalCost = [=](int count, bool sameSideExit) {
+        double length = count * std::sqrt(2.0) * tileLength / 2.0;
+        double dx = length * std::cos(M_PI / 4.0) - wallWidth / 2.0;
+        double dy = length * std::sin(M_PI / 4.0);
+        double entryAngle = std::atan2(dy, dx);
+        double exitAngle = std::abs((sameSideExit ? M_PI / 2.0 : 0.0) - entryAngle);
+        return (
+            entryAngle / turnRate +
+            std::sqrt(dx * dx + dy * dy) / forwardSpeed +
+            exitAngle / turnRate +
+            (wallWidth / 2.0) / forwardSpeed
+        );
+    };
+
+    // States are (tile just entered, heading), as tileIndex * 4 + direction
+    int numStates = 4 * walls.getWidth() * walls.getHeight();
+    auto toState = [](int index, Direction direction) {
+        return 4 * index + static_cast<int>(direction);
+    };
+    QVector<double> costs(numStates, std::numeric_limits<double>::infinity());
+    QVector<int> previous(numStates, -1);
+    QVector<QString> previousMove(numStates);
+
+    typedef QPair<double, int> Entry;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+
+    // Time is measured from the moment the mouse leaves the origin
+    int origin = walls.getTileIndex(0, 0);
+    for (Direction direction : DIRECTIONS()) {
+        int neighbor = walls.getNeighborIndex(origin, direction);
+        if (neighbor != -1 && !walls.isWall(origin, direction)) {
+            int state = toState(neighbor, direction);
+            costs[state] = 0.0;
+            queue.push({0.0, state});
+        }
+    }
+
+    auto relax = [&](int from, int to, double cost, const QString& move) {
+        double total = costs.at(from) + cost;
+        if (total < costs.at(to)) {
+            costs[to] = total;
+            previous[to] = from;
+            previousMove[to] = move;
+            queue.push({total, to});
+        }
+    };
+
+    int goal = -1;
+    while (!queue.empty()) {
+        Entry entry = queue.top();
+        queue.pop();
+        int state = entry.second;
+        if (costs.at(state) < entry.first) {
+            continue;
+        }
+        int index = state / 4;
+        Direction heading = static_cast<Direction>(state % 4);
+        int x = index % walls.getWidth();
+        int y = index / walls.getWidth();
+        if (maze->isCenterTile(x, y)) {
+            goal = state;
+            break;
+        }
+
+        // Moving forward, curve turns, and turning around
+        QVector<QPair<Direction, QPair<double, QString>>> exits {
+            {heading, {forwardCost, "moveForwardToEdge"}},
+            {DIRECTION_ROTATE_LEFT().value(heading), {curveCost, "turnLeftToEdge"}},
+            {DIRECTION_ROTATE_RIGHT().value(heading), {curveCost, "turnRightToEdge"}},
+            {DIRECTION_OPPOSITE().value(heading), {turnAroundCost, "turnAroundLeftToEdge"}},
+        };
+        for (const auto& exit : exits) {
+            int neighbor = walls.getNeighborIndex(index, exit.first);
+            if (neighbor != -1 && !walls.isWall(index, exit.first)) {
+                relax(state, toState(neighbor, exit.first), exit.second.first, exit.second.second);
+            }
+        }
+
+        // Diagonals alternate between crossing the edge on the starting side
+        // and the edge straight ahead, for as long as those edges are open
+        for (bool startLeft : {true, false}) {
+            Direction side = (
+                startLeft
+                ? DIRECTION_ROTATE_LEFT().value(heading)
+                : DIRECTION_ROTATE_RIGHT().value(heading)
+            );
+            int current = index;
+            for (int count = 1; ; count += 1) {
+                Direction crossing = (count % 2 == 1 ? side : heading);
+                int next = walls.getNeighborIndex(current, crossing);
+                if (next == -1 || walls.isWall(current, crossing)) {
+                    break;
+                }
+                current = next;
+                bool sameSideExit = (count % 2 == 1);
+                QString name = QString("diagonal%1%2(%3)").arg(
+                    startLeft ? "Left" : "Right",
+                    (startLeft == sameSideExit) ? "Left" : "Right",
+                    QString::number(count));
+                relax(state, toState(current, crossing), diagonalCost(count, sameSideExit), name);
+            }
+        }
+    }
+
+    if (goal == -1) {
+        return path;
+    }
+
+    // Walk the path backward, merging consecutive forward movements
+    QStringList moves;
+    int forwardCount = 0;
+    for (int state = goal; previous.at(state) != -1; state = previous.at(state)) {
+        const QString& move = previousMove.at(state);
+        if (move == "moveForwardToEdge") {
+            forwardCount += 1;
+            continue;
+        }
+        if (0 < forwardCount) {
+            moves.prepend(QString("moveForwardToEdge(%1)").arg(forwardCount));
+            forwardCount = 0;
+        }
+        moves.prepend(move);
+    }
+    if (0 < forwardCount) {
+        moves.prepend(QString("moveForwardToEdge(%1)").arg(forwardCount));
+    }
+
+    path.isReachable = true;
+    path.timeToCenter = Duration::Seconds(costs.at(goal));
+    path.moves = moves;
+    return path;
+}
+
+} // namespace mms
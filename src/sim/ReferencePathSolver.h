@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Maze.h"
+#include "Mouse.h"
+#include "ReferencePath.h"
+
+namespace mms {
+
+// Finds the time-optimal path to the center of the maze over a state graph of
+// (tile just entered, heading) pairs, i.e., the poses at which the tile edge
+// movements start and end. The edges of the graph are those movements
+// (moving forward, curve turns, turning around, and diagonals), each costed
+// by the time the mouse takes to perform it at the given wheel speed
+// fraction, using the same wheel speeds as MouseInterface.
+class ReferencePathSolver {
+
+public:
+
+    ReferencePathSolver() = delete;
+
+    static ReferencePath solve(
+        const Maze* maze,
+        const Mouse* mouse,
+        double wheelSpeedFraction = 1.0);
+
+};
+
+} // namespace mms
@@ -0,0 +1,106 @@
+#include "RenderStats.h"
+
+#include "Assert.h"
+
+namespace mms {
+
+const int RenderStats::CAPACITY = 120;
+
+RenderStats::RenderStats() :
+        m_frames(CAPACITY),
+        m_timestamps(CAPACITY, 0),
+        m_next(0),
+        m_size(0) {
+    m_clock.start();
+}
+
+void RenderStats::record(const FrameStats& frame) {
+    m_frames[m_next] = frame;
+    m_timestamps[m_next] = m_clock.nsecsElapsed();
+    m_next = (m_next + 1) % CAPACITY;
+    if (m_size < CAPACITY) {
+        m_size += 1;
+    }
+}
+
+void RenderStats::clear() {
+    m_next = 0;
+    m_size = 0;
+}
+
+int RenderStats::size() const {
+    return m_size;
+}
+
+FrameStats RenderStats::at(int index) const {
+    ASSERT_LE(0, index);
+    ASSERT_LT(index, m_size);
+    return m_frames.at((m_next - 1 - index + CAPACITY) % CAPACITY);
+}
+
+FrameStats RenderStats::latest() const {
+    if (m_size == 0) {
+        return FrameStats();
+    }
+    return at(0);
+}
+
+FrameStats RenderStats::average() const {
+    FrameStats total;
+    if (m_size == 0) {
+        return total;
+    }
+    double bytesUploaded = 0.0;
+    for (int i = 0; i < m_size; i += 1) {
+        const FrameStats& frame = m_frames.at(i);
+        total.frameTime += frame.frameTime;
+        total.mouseDrawTime += frame.mouseDrawTime;
+        total.uploadTime += frame.uploadTime;
+        total.drawCallTime += frame.drawCallTime;
+        total.gpuTime += frame.gpuTime;
+        bytesUploaded += frame.bytesUploaded;
+    }
+    double factor = 1.0 / m_size;
+    total.frameTime = total.frameTime * factor;
+    total.mouseDrawTime = total.mouseDrawTime * factor;
+    total.uploadTime = total.uploadTime * factor;
+    total.drawCallTime = total.drawCallTime * factor;
+    total.gpuTime = total.gpuTime * factor;
+    total.bytesUploaded = static_cast<int>(bytesUploaded * factor);
+    return total;
+}
+
+double RenderStats::framesPerSecond() const {
+    if (m_size < 2) {
+        return 0.0;
+    }
+    qint64 newest = m_timestamps.at((m_next - 1 + CAPACITY) % CAPACITY);
+    qint64 oldest = m_timestamps.at((m_next - m_size + CAPACITY) % CAPACITY);
+    if (newest <= oldest) {
+        return 0.0;
+    }
+    return (m_size - 1) * 1000000000.0 / (newest - oldest);
+}
+
+QString RenderStats::summary() const {
+    FrameStats avg = average();
+    return QString(
+        "FPS: %1\n"
+        "Frame (ms): %2\n"
+        "  Mouse: %3\n"
+        "  Upload: %4\n"
+        "  Draw: %5\n"
+        "GPU (ms): %6\n"
+        "Upload (KB): %7"
+    ).arg(
+        QString::number(framesPerSecond(), 'f', 1),
+        QString::number(avg.frameTime.getMilliseconds(), 'f', 3),
+        QString::number(avg.mouseDrawTime.getMilliseconds(), 'f', 3),
+        QString::number(avg.uploadTime.getMilliseconds(), 'f', 3),
+        QString::number(avg.drawCallTime.getMilliseconds(), 'f', 3),
+        QString::number(avg.gpuTime.getMilliseconds(), 'f', 3),
+        QString::number(avg.bytesUploaded / 1024.0, 'f', 1)
+    );
+}
+
+} // namespace mms
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <QElapsedTimer>
+#include <QString>
+#include <QVector>
+
+#include "units/Duration.h"
+
+namespace mms {
+
+// The cost of rendering a single frame of the map
+struct FrameStats {
+    Duration frameTime;
+    Duration mouseDrawTime;
+    Duration uploadTime;
+    Duration drawCallTime;
+    Duration gpuTime;
+    int bytesUploaded = 0;
+};
+
+class RenderStats {
+
+public:
+
+    // The number of frames retained by the ring buffer
+    static const int CAPACITY;
+
+    RenderStats();
+
+    // Overwrites the oldest frame once the buffer is full
+    void record(const FrameStats& frame);
+    void clear();
+
+    // Query the retained frames; index zero is the most recent
+    int size() const;
+    FrameStats at(int index) const;
+    FrameStats latest() const;
+    FrameStats average() const;
+
+    // Frames per second, computed from the spacing of the retained frames
+    double framesPerSecond() const;
+
+    // A short multi-line summary, suitable for the map overlay
+    QString summary() const;
+
+private:
+
+    // Preallocated once; record() never allocates
+    QVector<FrameStats> m_frames;
+    QElapsedTimer m_clock;
+    QVector<qint64> m_timestamps;
+    int m_next;
+    int m_size;
+
+};
+
+} // namespace mms
@@ -1,5 +1,6 @@
 #include "Resources.h"
 
+#include <QCoreApplication>
 #include <QDir>
 
 namespace mms {
@@ -16,6 +17,10 @@ QStringList Resources::getMice() {
     return getFiles(":/resources/mice/");
 }
 
+QString Resources::getGeneratedMazeDirectory() {
+    return QDir(QCoreApplication::applicationDirPath()).filePath("resources/mazes/");
+}
+
 QStringList Resources::getFiles(QString path) {
     QStringList files;
     for (const auto& info : QDir(path).entryInfoList()) {
@@ -15,6 +15,10 @@ public:
     static QStringList getMazes();
     static QStringList getMice();
 
+    // The bundled resources are read-only, so generated mazes are saved to
+    // the same layout on disk, next to the simulator
+    static QString getGeneratedMazeDirectory();
+
 private:
 
     static QStringList getFiles(QString path);
@@ -5,6 +5,8 @@
 
 #include <algorithm>
 
+#include "units/Rotation.h"
+
 #include "Assert.h"
 #include "GeometryUtilities.h"
 #include "Param.h"
@@ -24,11 +26,13 @@ Sensor::Sensor(
     const Angle& halfWidth,
     const Coordinate& position,
     const Angle& direction,
-    const Maze& maze) :
+    const Maze& maze,
+    const Noise& noise) :
     m_range(range),
     m_halfWidth(halfWidth),
     m_initialPosition(position),
-    m_initialDirection(direction) {
+    m_initialDirection(direction),
+    m_noise(noise) {
 
     // Create the polygon for the body of the sensor
     m_initialPolygon = GeometryUtilities::createCirclePolygon(
@@ -62,6 +66,10 @@ const Polygon& Sensor::getInitialViewPolygon() const {
     return m_initialViewPolygon;
 }
 
+const Noise& Sensor::getNoise() const {
+    return m_noise;
+}
+
 Polygon Sensor::getCurrentViewPolygon(
         const Coordinate& currentPosition,
         const Angle& currentDirection,
@@ -78,15 +86,24 @@ void Sensor::updateReading(
         const Angle& currentDirection,
         const Maze& maze) {
 
-    m_currentReading = std::max(
+    m_currentReading = getReading(currentPosition, currentDirection, maze);
+}
+
+double Sensor::getReading(
+        const Coordinate& currentPosition,
+        const Angle& currentDirection,
+        const Maze& maze) const {
+
+    double reading = std::max(
         0.0,
         1.0 - 
             getViewPolygon(currentPosition, currentDirection, maze)
                 .area().getMetersSquared() /
             getInitialViewPolygon().area().getMetersSquared());
 
-    ASSERT_LE(0.0, m_currentReading);
-    ASSERT_LE(m_currentReading, 1.0);
+    ASSERT_LE(0.0, reading);
+    ASSERT_LE(reading, 1.0);
+    return reading;
 }
 
 Polygon Sensor::getViewPolygon(
@@ -103,19 +120,24 @@ Polygon Sensor::getViewPolygon(
 
     QVector<Coordinate> polygon {currentPosition};
 
-    for (double i = -1; i <= 1; i += 2.0 / (P()->numberOfSensorEdgePoints() - 1)) {
+    // Sweep the ray across the view by composing a fixed step rotation,
+    // rather than computing the trig functions for every ray
+    double step = 2.0 / (P()->numberOfSensorEdgePoints() - 1);
+    Rotation stepRotation(m_halfWidth * step);
+    Rotation rayRotation(currentDirection - m_halfWidth);
+    Coordinate ray = Coordinate::Cartesian(m_range, Distance());
+
+    for (double i = -1; i <= 1; i += step) {
         polygon.push_back(
             GeometryUtilities::castRay(
                 currentPosition,
-                currentPosition + Coordinate::Polar(
-                    m_range,
-                    currentDirection + (m_halfWidth * i)
-                ),
+                currentPosition + rayRotation.rotate(ray),
                 maze,
                 halfWallWidth,
                 tileLength
             )
         );
+        rayRotation = rayRotation + stepRotation;
     }
 
     return Polygon(polygon);
@@ -7,6 +7,7 @@
 #include "units/Distance.h"
 
 #include "Maze.h"
+#include "Noise.h"
 #include "Polygon.h"
 
 namespace mms {
@@ -21,12 +22,14 @@ public:
         const Angle& halfWidth,
         const Coordinate& position,
         const Angle& direction,
-        const Maze& maze);
+        const Maze& maze,
+        const Noise& noise);
 
     const Coordinate& getInitialPosition() const;
     const Angle& getInitialDirection() const;
     const Polygon& getInitialPolygon() const;
     const Polygon& getInitialViewPolygon() const;
+    const Noise& getNoise() const;
     Polygon getCurrentViewPolygon(
         const Coordinate& currentPosition,
         const Angle& currentDirection,
@@ -38,6 +41,13 @@ public:
         const Angle& currentDirection,
         const Maze& maze);
 
+    // The reading the sensor would have at the given position and direction,
+    // without changing its current reading; safe to call from many threads
+    double getReading(
+        const Coordinate& currentPosition,
+        const Angle& currentDirection,
+        const Maze& maze) const;
+
 private:
     Distance m_range;
     Angle m_halfWidth;
@@ -46,6 +56,7 @@ private:
     Angle m_initialDirection;
     Polygon m_initialPolygon;
     Polygon m_initialViewPolygon;
+    Noise m_noise;
 
     double m_currentReading;
 
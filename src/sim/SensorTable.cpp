@@ -0,0 +1,202 @@
+#include "SensorTable.h"
+
+#include <QThread>
+#include <QtMath>
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "units/Distance.h"
+
+#include "Param.h"
+
+namespace mms {
+
+SensorTable::SensorTable() :
+    m_numX(0),
+    m_numY(0),
+    m_numTheta(0),
+    m_positionResolution(0.0),
+    m_rotationResolution(0.0),
+    m_maximumError(0.0),
+    m_meanError(0.0) {
+}
+
+SensorTable SensorTable::build(
+        const Sensor& sensor,
+        const Maze& maze,
+        double positionResolution,
+        double rotationResolution) {
+
+    SensorTable table;
+    if (maze.getWidth() == 0 || maze.getHeight() == 0) {
+        return table;
+    }
+
+    // The grid spans the whole maze, with the directions evenly dividing a
+    // full rotation, so that the last direction wraps around to the first
+    double tileLength = P()->wallLength() + P()->wallWidth();
+    double maxX = maze.getWidth() * tileLength;
+    double maxY = maze.getHeight() * tileLength;
+    table.m_positionResolution = positionResolution;
+    table.m_numX = static_cast<int>(std::ceil(maxX / positionResolution)) + 1;
+    table.m_numY = static_cast<int>(std::ceil(maxY / positionResolution)) + 1;
+    table.m_numTheta = std::max(1, qRound(2 * M_PI / rotationResolution));
+    table.m_rotationResolution = 2 * M_PI / table.m_numTheta;
+    table.m_readings.resize(table.m_numX * table.m_numY * table.m_numTheta);
+
+    // Each worker takes the next unfinished column of the grid; the columns
+    // are disjoint, so the workers can write the readings without locking
+    quint16* readings = table.m_readings.data();
+    std::atomic<int> nextColumn(0);
+    auto work = [&]() {
+        for (int x = nextColumn++; x < table.m_numX; x = nextColumn++) {
+            Distance px = Distance::Meters(x * table.m_positionResolution);
+            for (int y = 0; y < table.m_numY; y += 1) {
+                Coordinate position = Coordinate::Cartesian(
+                    px,
+                    Distance::Meters(y * table.m_positionResolution));
+                for (int theta = 0; theta < table.m_numTheta; theta += 1) {
+                    double reading = sensor.getReading(
+                        position,
+                        Angle::Radians(theta * table.m_rotationResolution),
+                        maze);
+                    readings[table.getNodeIndex(x, y, theta)] =
+                        static_cast<quint16>(qRound(reading * 65535.0));
+                }
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int i = 0; i < std::max(1, QThread::idealThreadCount()); i += 1) {
+        threads.emplace_back(work);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Estimate the error of interpolating between the nodes, with a fixed
+    // seed so that the estimate is the same every time the table is built
+    static const int numSamples = 1000;
+    std::mt19937 random(0);
+    std::uniform_real_distribution<double> xs(0.0, maxX);
+    std::uniform_real_distribution<double> ys(0.0, maxY);
+    std::uniform_real_distribution<double> thetas(0.0, 2 * M_PI);
+    double sumOfErrors = 0.0;
+    for (int i = 0; i < numSamples; i += 1) {
+        Coordinate position = Coordinate::Cartesian(
+            Distance::Meters(xs(random)),
+            Distance::Meters(ys(random)));
+        Angle direction = Angle::Radians(thetas(random));
+        double error = std::abs(
+            table.lookup(position, direction) -
+            sensor.getReading(position, direction, maze));
+        table.m_maximumError = std::max(table.m_maximumError, error);
+        sumOfErrors += error;
+    }
+    table.m_meanError = sumOfErrors / numSamples;
+
+    return table;
+}
+
+bool SensorTable::isEmpty() const {
+    return m_readings.isEmpty();
+}
+
+double SensorTable::getMaximumError() const {
+    return m_maximumError;
+}
+
+double SensorTable::getMeanError() const {
+    return m_meanError;
+}
+
+double SensorTable::lookup(const Coordinate& position, const Angle& direction) const {
+
+    if (isEmpty()) {
+        return 0.0;
+    }
+
+    // The grid coordinates of the pose, along with the lower node and the
+    // fraction of the way to the upper node, for each axis
+    double fx = qBound(
+        0.0,
+        position.getX().getMeters() / m_positionResolution,
+        static_cast<double>(m_numX - 1));
+    double fy = qBound(
+        0.0,
+        position.getY().getMeters() / m_positionResolution,
+        static_cast<double>(m_numY - 1));
+    double ft = direction.getRadiansZeroTo2pi() / m_rotationResolution;
+    int x0 = std::min(static_cast<int>(fx), m_numX - 2);
+    int y0 = std::min(static_cast<int>(fy), m_numY - 2);
+    int t0 = static_cast<int>(ft);
+    double tx = fx - x0;
+    double ty = fy - y0;
+    double tt = ft - t0;
+    t0 %= m_numTheta;
+    int t1 = (t0 + 1) % m_numTheta;
+
+    double sum = 0.0;
+    for (int i = 0; i < 8; i += 1) {
+        int x = x0 + (i & 1);
+        int y = y0 + ((i >> 1) & 1);
+        int t = ((i >> 2) & 1) ? t1 : t0;
+        double weight =
+            ((i & 1) ? tx : 1.0 - tx) *
+            (((i >> 1) & 1) ? ty : 1.0 - ty) *
+            (((i >> 2) & 1) ? tt : 1.0 - tt);
+        sum += weight * m_readings.at(getNodeIndex(x, y, t));
+    }
+    return sum / 65535.0;
+}
+
+void SensorTable::write(QDataStream* stream) const {
+    *stream
+        << static_cast<qint32>(m_numX)
+        << static_cast<qint32>(m_numY)
+        << static_cast<qint32>(m_numTheta)
+        << m_positionResolution
+        << m_rotationResolution
+        << m_maximumError
+        << m_meanError
+        << m_readings;
+}
+
+SensorTable SensorTable::read(QDataStream* stream) {
+    SensorTable table;
+    qint32 numX = 0;
+    qint32 numY = 0;
+    qint32 numTheta = 0;
+    *stream
+        >> numX
+        >> numY
+        >> numTheta
+        >> table.m_positionResolution
+        >> table.m_rotationResolution
+        >> table.m_maximumError
+        >> table.m_meanError
+        >> table.m_readings;
+    table.m_numX = numX;
+    table.m_numY = numY;
+    table.m_numTheta = numTheta;
+    if (
+        stream->status() != QDataStream::Ok ||
+        numX < 2 || numY < 2 || numTheta < 1 ||
+        table.m_positionResolution <= 0.0 ||
+        table.m_rotationResolution <= 0.0 ||
+        table.m_readings.size() != numX * numY * numTheta
+    ) {
+        throw std::runtime_error("malformed sensor table");
+    }
+    return table;
+}
+
+int SensorTable::getNodeIndex(int x, int y, int theta) const {
+    return (x * m_numY + y) * m_numTheta + theta;
+}
+
+} // namespace mms
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <QDataStream>
+#include <QVector>
+
+#include "units/Angle.h"
+#include "units/Coordinate.h"
+
+#include "Maze.h"
+#include "Sensor.h"
+
+namespace mms {
+
+// The readings of a single sensor over a discretized grid of sensor poses
+// (x, y, and direction) that covers the whole maze. For a given maze and
+// sensor geometry, a reading depends only on the pose of the sensor, so the
+// table can stand in for ray casting, at the cost of some interpolation
+// error. That error is estimated when the table is built, by comparing the
+// interpolated readings against exact ones at random poses.
+class SensorTable {
+
+public:
+
+    // An empty table, with no readings
+    SensorTable();
+
+    // Computes the readings at every node of the grid, using all cores. The
+    // resolutions are the spacing of the nodes, in meters and radians.
+    static SensorTable build(
+        const Sensor& sensor,
+        const Maze& maze,
+        double positionResolution,
+        double rotationResolution);
+
+    bool isEmpty() const;
+
+    // The estimated maximum and mean absolute errors of lookup()
+    double getMaximumError() const;
+    double getMeanError() const;
+
+    // Trilinearly interpolates the readings of the surrounding nodes;
+    // positions outside of the maze are clamped to its boundary
+    double lookup(const Coordinate& position, const Angle& direction) const;
+
+    // Reads and writes the table; read() throws if the data is malformed
+    void write(QDataStream* stream) const;
+    static SensorTable read(QDataStream* stream);
+
+private:
+
+    // The number of nodes along each axis, and the spacing between them
+    int m_numX;
+    int m_numY;
+    int m_numTheta;
+    double m_positionResolution;
+    double m_rotationResolution;
+
+    double m_maximumError;
+    double m_meanError;
+
+    // The readings, quantized to 16 bits, indexed by getNodeIndex()
+    QVector<quint16> m_readings;
+
+    int getNodeIndex(int x, int y, int theta) const;
+
+};
+
+} // namespace mms
@@ -0,0 +1,157 @@
+#include "SensorTableCache.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QtMath>
+
+#include "Param.h"
+
+namespace mms {
+
+const quint32 SensorTableCache::MAGIC = 0x4D4D5354; // "MMST"
+const qint32 SensorTableCache::VERSION = 1;
+
+QMap<QString, SensorTable> SensorTableCache::get(
+        const QString& mouseFile,
+        const QMap<QString, Sensor>& sensors,
+        const Maze& maze) {
+
+    QMap<QString, SensorTable> tables;
+    if (P()->sensorTableDirectory().isEmpty() || sensors.isEmpty()) {
+        return tables;
+    }
+
+    QString path;
+    try {
+        path = QDir(P()->sensorTableDirectory()).filePath(
+            QString(getKey(mouseFile, maze).toHex()) + ".mst");
+    }
+    catch (const std::exception& e) {
+        qWarning().nospace()
+            << "Unable to use sensor tables for mouse file " << mouseFile
+            << ": " << QString(e.what()) << ".";
+        return tables;
+    }
+
+    // Use the cached tables if they cover all of the sensors
+    if (QFile::exists(path)) {
+        try {
+            tables = load(path);
+        }
+        catch (const std::exception& e) {
+            qWarning().nospace()
+                << "Unable to load sensor tables from " << path << ": "
+                << QString(e.what()) << ". Rebuilding them.";
+            tables.clear();
+        }
+        for (const QString& name : sensors.keys()) {
+            if (!tables.contains(name)) {
+                tables.clear();
+                break;
+            }
+        }
+    }
+
+    if (tables.isEmpty()) {
+        double positionResolution = P()->sensorTablePositionResolution();
+        double rotationResolution = qDegreesToRadians(P()->sensorTableRotationResolution());
+        for (auto it = sensors.constBegin(); it != sensors.constEnd(); ++it) {
+            tables.insert(it.key(), SensorTable::build(
+                it.value(),
+                maze,
+                positionResolution,
+                rotationResolution));
+        }
+        try {
+            QDir().mkpath(P()->sensorTableDirectory());
+            save(path, tables);
+        }
+        catch (const std::exception& e) {
+            qWarning().nospace()
+                << "Unable to save sensor tables to " << path << ": "
+                << QString(e.what()) << ".";
+        }
+    }
+
+    for (auto it = tables.constBegin(); it != tables.constEnd(); ++it) {
+        qInfo().noquote().nospace()
+            << "Sensor table for \"" << it.key() << "\": maximum error "
+            << it.value().getMaximumError() << ", mean error "
+            << it.value().getMeanError() << ".";
+    }
+    return tables;
+}
+
+QByteArray SensorTableCache::getKey(const QString& mouseFile, const Maze& maze) {
+
+    QFile file(mouseFile);
+    if (!file.open(QIODevice::ReadOnly)) {
+        throw std::runtime_error("unable to read mouse file");
+    }
+
+    // The walls are hashed in the maze's own coordinates, so transformed
+    // mazes with the same walls share their tables
+    BasicMaze walls = maze.getWalls().normalized();
+    QByteArray bytes;
+    QDataStream stream(&bytes, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_0);
+    stream
+        << VERSION
+        << static_cast<qint32>(walls.getWidth())
+        << static_cast<qint32>(walls.getHeight())
+        << walls.getHorizontalWalls()
+        << walls.getVerticalWalls()
+        << P()->wallWidth()
+        << P()->wallLength()
+        << static_cast<qint32>(P()->numberOfSensorEdgePoints())
+        << P()->sensorTablePositionResolution()
+        << P()->sensorTableRotationResolution()
+        << file.readAll();
+
+    return QCryptographicHash::hash(bytes, QCryptographicHash::Sha1);
+}
+
+QMap<QString, SensorTable> SensorTableCache::load(const QString& path) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        throw std::runtime_error("unable to open file");
+    }
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_0);
+    quint32 magic = 0;
+    qint32 version = 0;
+    qint32 count = 0;
+    stream >> magic >> version >> count;
+    if (magic != MAGIC || version != VERSION || count < 0) {
+        throw std::runtime_error("not a sensor table file");
+    }
+    QMap<QString, SensorTable> tables;
+    for (int i = 0; i < count; i += 1) {
+        QString name;
+        stream >> name;
+        tables.insert(name, SensorTable::read(&stream));
+    }
+    return tables;
+}
+
+void SensorTableCache::save(const QString& path, const QMap<QString, SensorTable>& tables) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        throw std::runtime_error("unable to open file");
+    }
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_0);
+    stream << MAGIC << VERSION << static_cast<qint32>(tables.size());
+    for (auto it = tables.constBegin(); it != tables.constEnd(); ++it) {
+        stream << it.key();
+        it.value().write(&stream);
+    }
+    if (stream.status() != QDataStream::Ok) {
+        throw std::runtime_error("unable to write file");
+    }
+}
+
+} // namespace mms
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <QByteArray>
+#include <QMap>
+#include <QString>
+
+#include "Maze.h"
+#include "Sensor.h"
+#include "SensorTable.h"
+
+namespace mms {
+
+// Provides the sensor tables for a (maze, mouse file) pair. Tables are only
+// used if a sensor table directory is configured; they're saved there under a
+// hash of the maze walls, the mouse file, and the parameters that affect the
+// readings, so that each pair only has to be built once.
+class SensorTableCache {
+
+public:
+
+    SensorTableCache() = delete;
+
+    // Returns the tables for all of the sensors, keyed by sensor name, or no
+    // tables at all if they're disabled or can't be built
+    static QMap<QString, SensorTable> get(
+        const QString& mouseFile,
+        const QMap<QString, Sensor>& sensors,
+        const Maze& maze);
+
+private:
+
+    static const quint32 MAGIC;
+    static const qint32 VERSION;
+
+    // Throws if the mouse file can't be read
+    static QByteArray getKey(const QString& mouseFile, const Maze& maze);
+
+    // Both throw on failure
+    static QMap<QString, SensorTable> load(const QString& path);
+    static void save(const QString& path, const QMap<QString, SensorTable>& tables);
+
+};
+
+} // namespace mms
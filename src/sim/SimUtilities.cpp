@@ -10,6 +10,7 @@
 
 #include "Assert.h"
 #include "Param.h"
+#include "VertexPosition.h"
 
 namespace mms {
 
@@ -109,14 +110,33 @@ QVector<TriangleGraphic> SimUtilities::polygonToTriangleGraphics(
         const Polygon& polygon,
         Color color,
         double alpha) {
-    QVector<Triangle> triangles = polygon.getTriangles();
+    return polygonToTriangleGraphics(
+        polygon.transformed(AffineTransform()),
+        color,
+        alpha);
+}
+
+QVector<TriangleGraphic> SimUtilities::polygonToTriangleGraphics(
+        const TransformedPolygon& polygon,
+        Color color,
+        double alpha) {
+    // Map each vertex once, and then index into the mapped vertices
+    QVector<VertexPosition> positions(polygon.size());
+    for (int i = 0; i < polygon.size(); i += 1) {
+        positions[i] = {polygon.getX(i), polygon.getY(i)};
+    }
+    const QVector<int>& triangulation = polygon.getTriangulation();
     QVector<TriangleGraphic> triangleGraphics;
+    triangleGraphics.reserve(triangulation.size() / 3);
     RGB colorValues = COLOR_TO_RGB().value(color);
-    for (Triangle triangle : triangles) {
+    for (int i = 0; i + 2 < triangulation.size(); i += 3) {
+        const VertexPosition& p1 = positions.at(triangulation.at(i));
+        const VertexPosition& p2 = positions.at(triangulation.at(i + 1));
+        const VertexPosition& p3 = positions.at(triangulation.at(i + 2));
         triangleGraphics.push_back({
-            {triangle.p1.getX().getMeters(), triangle.p1.getY().getMeters(), colorValues, alpha},
-            {triangle.p2.getX().getMeters(), triangle.p2.getY().getMeters(), colorValues, alpha},
-            {triangle.p3.getX().getMeters(), triangle.p3.getY().getMeters(), colorValues, alpha}
+            {p1.x, p1.y, colorValues, alpha},
+            {p2.x, p2.y, colorValues, alpha},
+            {p3.x, p3.y, colorValues, alpha}
         });
     }
     return triangleGraphics;
@@ -9,6 +9,7 @@
 
 #include "Color.h"
 #include "Polygon.h"
+#include "TransformedPolygon.h"
 #include "TriangleGraphic.h"
 #include "units/Duration.h"
 
@@ -60,6 +61,10 @@ public:
         const Polygon& polygon,
         Color color,
         double alpha);
+    static QVector<TriangleGraphic> polygonToTriangleGraphics(
+        const TransformedPolygon& polygon,
+        Color color,
+        double alpha);
 
 };
 
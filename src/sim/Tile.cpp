@@ -1,13 +1,11 @@
 #include "Tile.h"
 
+#include "Assert.h"
 #include "Param.h"
 
 namespace mms{
 
-Tile::Tile() : m_x(-1), m_y(-1), m_distance(-1) {
-    for (Direction direction : DIRECTIONS()) {
-        m_walls.insert(direction, false);
-    }
+Tile::Tile() : m_x(-1), m_y(-1), m_walls(nullptr), m_distance(-1) {
 }
 
 int Tile::getX() const {
@@ -24,11 +22,11 @@ void Tile::setPos(int x, int y) {
 }
 
 bool Tile::isWall(Direction direction) const {
-    return m_walls.value(direction);
+    return m_walls->isWall(m_x, m_y, direction);
 }
 
-void Tile::setWall(Direction direction, bool isWall) {
-    m_walls[direction] = isWall;
+void Tile::setWalls(const BasicMaze* walls) {
+    m_walls = walls;
 }
 
 int Tile::getDistance() const {
@@ -40,22 +38,96 @@ void Tile::setDistance(int distance) {
 }
 
 Polygon Tile::getFullPolygon() const {
-    return m_fullPolygon;
+    Bounds b = getBounds();
+    return Polygon({
+        Coordinate::Cartesian(b.outerLeft, b.outerBottom),
+        Coordinate::Cartesian(b.outerLeft, b.outerTop),
+        Coordinate::Cartesian(b.outerRight, b.outerTop),
+        Coordinate::Cartesian(b.outerRight, b.outerBottom),
+    });
 }
 
 Polygon Tile::getInteriorPolygon() const {
-    return m_interiorPolygon;
+    Bounds b = getBounds();
+    return Polygon({
+        Coordinate::Cartesian(b.innerLeft, b.innerBottom),
+        Coordinate::Cartesian(b.innerLeft, b.innerTop),
+        Coordinate::Cartesian(b.innerRight, b.innerTop),
+        Coordinate::Cartesian(b.innerRight, b.innerBottom),
+    });
 }
 
 Polygon Tile::getWallPolygon(Direction direction) const {
-    return m_wallPolygons.value(direction);
+    Bounds b = getBounds();
+    switch (direction) {
+        case Direction::NORTH:
+            return Polygon({
+                Coordinate::Cartesian(b.innerLeft, b.innerTop),
+                Coordinate::Cartesian(b.innerLeft, b.outerTop),
+                Coordinate::Cartesian(b.innerRight, b.outerTop),
+                Coordinate::Cartesian(b.innerRight, b.innerTop),
+            });
+        case Direction::EAST:
+            return Polygon({
+                Coordinate::Cartesian(b.innerRight, b.innerBottom),
+                Coordinate::Cartesian(b.innerRight, b.innerTop),
+                Coordinate::Cartesian(b.outerRight, b.innerTop),
+                Coordinate::Cartesian(b.outerRight, b.innerBottom),
+            });
+        case Direction::SOUTH:
+            return Polygon({
+                Coordinate::Cartesian(b.innerLeft, b.outerBottom),
+                Coordinate::Cartesian(b.innerLeft, b.innerBottom),
+                Coordinate::Cartesian(b.innerRight, b.innerBottom),
+                Coordinate::Cartesian(b.innerRight, b.outerBottom),
+            });
+        case Direction::WEST:
+            return Polygon({
+                Coordinate::Cartesian(b.outerLeft, b.innerBottom),
+                Coordinate::Cartesian(b.outerLeft, b.innerTop),
+                Coordinate::Cartesian(b.innerLeft, b.innerTop),
+                Coordinate::Cartesian(b.innerLeft, b.innerBottom),
+            });
+    }
+    ASSERT_NEVER_RUNS();
+    return Polygon();
 }
 
 QVector<Polygon> Tile::getCornerPolygons() const {
-    return m_cornerPolygons;
-}
-
-void Tile::initPolygons(int mazeWidth, int mazeHeight) {
+    Bounds b = getBounds();
+    return {
+        // Lower left
+        Polygon({
+            Coordinate::Cartesian(b.outerLeft, b.outerBottom),
+            Coordinate::Cartesian(b.outerLeft, b.innerBottom),
+            Coordinate::Cartesian(b.innerLeft, b.innerBottom),
+            Coordinate::Cartesian(b.innerLeft, b.outerBottom),
+        }),
+        // Upper left
+        Polygon({
+            Coordinate::Cartesian(b.outerLeft, b.innerTop),
+            Coordinate::Cartesian(b.outerLeft, b.outerTop),
+            Coordinate::Cartesian(b.innerLeft, b.outerTop),
+            Coordinate::Cartesian(b.innerLeft, b.innerTop),
+        }),
+        // Upper right
+        Polygon({
+            Coordinate::Cartesian(b.innerRight, b.innerTop),
+            Coordinate::Cartesian(b.innerRight, b.outerTop),
+            Coordinate::Cartesian(b.outerRight, b.outerTop),
+            Coordinate::Cartesian(b.outerRight, b.innerTop),
+        }),
+        // Lower right
+        Polygon({
+            Coordinate::Cartesian(b.innerRight, b.outerBottom),
+            Coordinate::Cartesian(b.innerRight, b.innerBottom),
+            Coordinate::Cartesian(b.outerRight, b.innerBottom),
+            Coordinate::Cartesian(b.outerRight, b.outerBottom),
+        }),
+    };
+}
+
+Tile::Bounds Tile::getBounds() const {
 
     //  The polygons associated with each tile are as follows:
     //
@@ -81,201 +153,33 @@ void Tile::initPolygons(int mazeWidth, int mazeHeight) {
     //      |   |             |   |
     //      |   |             |   |
     //      |   |             |   |
+    //      |   |             |   |
     //      1---2-------------d---e
     //      |   |             |   |
     //      0---3-------------c---f
-
-    // Order is important
-    initFullPolygon(mazeWidth, mazeHeight);
-    initInteriorPolygon(mazeWidth, mazeHeight);
-    initWallPolygons(mazeWidth, mazeHeight);
-    initCornerPolygons(mazeWidth, mazeHeight);
-}
-
-
-void Tile::initFullPolygon(int mazeWidth, int mazeHeight) {
+    //
+    //  All of them are determined by the outer (full) and inner (interior)
+    //  rectangles, which are pure functions of the position of the tile, the
+    //  size of the maze, and the wall dimensions. Tiles on the edge of the
+    //  maze extend by an extra half wall width, so that the posts and walls
+    //  on the boundary are as thick as the interior ones.
+
+    ASSERT_FA(m_walls == nullptr);
+    int mazeWidth = m_walls->getWidth();
+    int mazeHeight = m_walls->getHeight();
     Distance halfWallWidth = Distance::Meters(P()->wallWidth()) / 2.0;
     Distance tileLength = Distance::Meters(P()->wallLength() + P()->wallWidth());
-    Coordinate lowerLeftPoint = Coordinate::Cartesian(
-        tileLength * getX() - halfWallWidth * (getX() == 0 ? 1 : 0),
-        tileLength * getY() - halfWallWidth * (getY() == 0 ? 1 : 0)
-    );
-    Coordinate upperRightPoint = Coordinate::Cartesian(
-        tileLength * (getX() + 1) + halfWallWidth * (getX() == mazeWidth - 1 ? 1 : 0),
-        tileLength * (getY() + 1) + halfWallWidth * (getY() == mazeHeight - 1 ? 1 : 0)
-    );
-    Coordinate lowerRightPoint = Coordinate::Cartesian(
-        upperRightPoint.getX(),
-        lowerLeftPoint.getY()
-    );
-    Coordinate upperLeftPoint = Coordinate::Cartesian(
-        lowerLeftPoint.getX(),
-        upperRightPoint.getY()
-    );
-    m_fullPolygon = Polygon({
-        lowerLeftPoint,
-        upperLeftPoint,
-        upperRightPoint,
-        lowerRightPoint,
-    });
-}
-
-void Tile::initInteriorPolygon(int mazeWidth, int mazeHeight) {
-
-    Distance halfWallWidth = Distance::Meters(P()->wallWidth()) / 2.0;
-    Coordinate lowerLeftPoint = m_fullPolygon.getVertices().at(0);
-    Coordinate upperLeftPoint = m_fullPolygon.getVertices().at(1);
-    Coordinate upperRightPoint = m_fullPolygon.getVertices().at(2);
-    Coordinate lowerRightPoint = m_fullPolygon.getVertices().at(3);
-
-    m_interiorPolygon = Polygon({
-        lowerLeftPoint + Coordinate::Cartesian(
-            halfWallWidth * (getX() == 0 ? 2 : 1),
-            halfWallWidth * (getY() == 0 ? 2 : 1)
-        ),
-        upperLeftPoint + Coordinate::Cartesian(
-            halfWallWidth * (getX() == 0 ? 2 : 1),
-            halfWallWidth * (getY() == mazeHeight - 1 ? -2 : -1)
-        ),
-        upperRightPoint + Coordinate::Cartesian(
-            halfWallWidth * (getX() == mazeWidth - 1 ? -2 : -1),
-            halfWallWidth * (getY() == mazeHeight - 1 ? -2 : -1)
-        ),
-        lowerRightPoint + Coordinate::Cartesian(
-            halfWallWidth * (getX() == mazeWidth - 1 ? -2 : -1),
-            halfWallWidth * (getY() == 0 ? 2 : 1)
-        ),
-    });
-}
-
-void Tile::initWallPolygons(int mazeWidth, int mazeHeight) {
-
-    Coordinate outerLowerLeftPoint = m_fullPolygon.getVertices().at(0);
-    Coordinate outerUpperLeftPoint = m_fullPolygon.getVertices().at(1);
-    Coordinate outerUpperRightPoint = m_fullPolygon.getVertices().at(2);
-    Coordinate outerLowerRightPoint = m_fullPolygon.getVertices().at(3);
-
-    Coordinate innerLowerLeftPoint = m_interiorPolygon.getVertices().at(0);
-    Coordinate innerUpperLeftPoint = m_interiorPolygon.getVertices().at(1);
-    Coordinate innerUpperRightPoint = m_interiorPolygon.getVertices().at(2);
-    Coordinate innerLowerRightPoint = m_interiorPolygon.getVertices().at(3);
-
-    QVector<Coordinate> northWall;
-    northWall.push_back(innerUpperLeftPoint);
-    northWall.push_back(Coordinate::Cartesian(
-        innerUpperLeftPoint.getX(),
-        outerUpperLeftPoint.getY()
-    ));
-    northWall.push_back(Coordinate::Cartesian(
-        innerUpperRightPoint.getX(),
-        outerUpperRightPoint.getY()
-    ));
-    northWall.push_back(innerUpperRightPoint);
-    m_wallPolygons.insert(Direction::NORTH, Polygon(northWall));
-
-    QVector<Coordinate> eastWall;
-    eastWall.push_back(innerLowerRightPoint);
-    eastWall.push_back(innerUpperRightPoint);
-    eastWall.push_back(Coordinate::Cartesian(
-        outerUpperRightPoint.getX(),
-        innerUpperRightPoint.getY()
-    ));
-    eastWall.push_back(Coordinate::Cartesian(
-        outerLowerRightPoint.getX(),
-        innerLowerRightPoint.getY()
-    ));
-    m_wallPolygons.insert(Direction::EAST, Polygon(eastWall));
-
-    QVector<Coordinate> southWall;
-    southWall.push_back(Coordinate::Cartesian(
-        innerLowerLeftPoint.getX(),
-        outerLowerLeftPoint.getY()
-    ));
-    southWall.push_back(innerLowerLeftPoint);
-    southWall.push_back(innerLowerRightPoint);
-    southWall.push_back(Coordinate::Cartesian(
-        innerLowerRightPoint.getX(),
-        outerLowerRightPoint.getY()
-    ));
-    m_wallPolygons.insert(Direction::SOUTH, Polygon(southWall));
-
-    QVector<Coordinate> westWall;
-    westWall.push_back(Coordinate::Cartesian(
-        outerLowerLeftPoint.getX(),
-        innerLowerLeftPoint.getY()
-    ));
-    westWall.push_back(Coordinate::Cartesian(
-        outerUpperLeftPoint.getX(),
-        innerUpperLeftPoint.getY()
-    ));
-    westWall.push_back(innerUpperLeftPoint);
-    westWall.push_back(innerLowerLeftPoint);
-    m_wallPolygons.insert(Direction::WEST, Polygon(westWall));
-}
-
-void Tile::initCornerPolygons(int mazeWidth, int mazeHeight) {
-
-    Coordinate outerLowerLeftPoint = m_fullPolygon.getVertices().at(0);
-    Coordinate outerUpperLeftPoint = m_fullPolygon.getVertices().at(1);
-    Coordinate outerUpperRightPoint = m_fullPolygon.getVertices().at(2);
-    Coordinate outerLowerRightPoint = m_fullPolygon.getVertices().at(3);
-
-    Coordinate innerLowerLeftPoint = m_interiorPolygon.getVertices().at(0);
-    Coordinate innerUpperLeftPoint = m_interiorPolygon.getVertices().at(1);
-    Coordinate innerUpperRightPoint = m_interiorPolygon.getVertices().at(2);
-    Coordinate innerLowerRightPoint = m_interiorPolygon.getVertices().at(3);
-
-    QVector<Coordinate> lowerLeftCorner;
-    lowerLeftCorner.push_back(outerLowerLeftPoint);
-    lowerLeftCorner.push_back(Coordinate::Cartesian(
-        outerLowerLeftPoint.getX(),
-        innerLowerLeftPoint.getY()
-    ));
-    lowerLeftCorner.push_back(innerLowerLeftPoint);
-    lowerLeftCorner.push_back(Coordinate::Cartesian(
-        innerLowerLeftPoint.getX(),
-        outerLowerLeftPoint.getY()
-    ));
-    m_cornerPolygons.push_back(Polygon(lowerLeftCorner));
-
-    QVector<Coordinate> upperLeftCorner;
-    upperLeftCorner.push_back(Coordinate::Cartesian(
-        outerUpperLeftPoint.getX(),
-        innerUpperLeftPoint.getY()
-    ));
-    upperLeftCorner.push_back(outerUpperLeftPoint);
-    upperLeftCorner.push_back(Coordinate::Cartesian(
-        innerUpperLeftPoint.getX(),
-        outerUpperLeftPoint.getY()
-    ));
-    upperLeftCorner.push_back(innerUpperLeftPoint);
-    m_cornerPolygons.push_back(Polygon(upperLeftCorner));
-
-    QVector<Coordinate> upperRightCorner;
-    upperRightCorner.push_back(innerUpperRightPoint);
-    upperRightCorner.push_back(Coordinate::Cartesian(
-        innerUpperRightPoint.getX(),
-        outerUpperRightPoint.getY()
-    ));
-    upperRightCorner.push_back(outerUpperRightPoint);
-    upperRightCorner.push_back(Coordinate::Cartesian(
-        outerUpperRightPoint.getX(),
-        innerUpperRightPoint.getY()
-    ));
-    m_cornerPolygons.push_back(Polygon(upperRightCorner));
 
-    QVector<Coordinate> lowerRightCorner;
-    lowerRightCorner.push_back(Coordinate::Cartesian(
-        innerLowerRightPoint.getX(),
-        outerLowerRightPoint.getY()
-    ));
-    lowerRightCorner.push_back(innerLowerRightPoint);
-    lowerRightCorner.push_back(Coordinate::Cartesian(
-        outerLowerRightPoint.getX(),
-        innerLowerRightPoint.getY()
-    ));
-    lowerRightCorner.push_back(outerLowerRightPoint);
-    m_cornerPolygons.push_back(Polygon(lowerRightCorner));
+    Bounds b;
+    b.outerLeft = tileLength * getX() - halfWallWidth * (getX() == 0 ? 1 : 0);
+    b.outerBottom = tileLength * getY() - halfWallWidth * (getY() == 0 ? 1 : 0);
+    b.outerRight = tileLength * (getX() + 1) + halfWallWidth * (getX() == mazeWidth - 1 ? 1 : 0);
+    b.outerTop = tileLength * (getY() + 1) + halfWallWidth * (getY() == mazeHeight - 1 ? 1 : 0);
+    b.innerLeft = b.outerLeft + halfWallWidth * (getX() == 0 ? 2 : 1);
+    b.innerBottom = b.outerBottom + halfWallWidth * (getY() == 0 ? 2 : 1);
+    b.innerRight = b.outerRight - halfWallWidth * (getX() == mazeWidth - 1 ? 2 : 1);
+    b.innerTop = b.outerTop - halfWallWidth * (getY() == mazeHeight - 1 ? 2 : 1);
+    return b;
 }
 
 } // namespace mms
@@ -1,8 +1,8 @@
 #pragma once
 
-#include <QMap>
 #include <QVector>
 
+#include "BasicMaze.h"
 #include "Direction.h"
 #include "Polygon.h"
 
@@ -17,34 +17,37 @@ public:
     int getY() const;
     void setPos(int x, int y);
 
+    // The walls are owned by the maze, and shared with the neighboring tiles
     bool isWall(Direction direction) const;
-    void setWall(Direction direction, bool isWall);
+    void setWalls(const BasicMaze* walls);
 
     int getDistance() const;
     void setDistance(int distance);
 
+    // The polygons aren't stored, they're generated on demand
     Polygon getFullPolygon() const;
     Polygon getInteriorPolygon() const;
     Polygon getWallPolygon(Direction direction) const;
     QVector<Polygon> getCornerPolygons() const;
 
-    void initPolygons(int mazeWidth, int mazeHeight);
-
 private:
     int m_x;
     int m_y;
-    QMap<Direction, bool> m_walls;
+    const BasicMaze* m_walls;
     int m_distance;
 
-    Polygon m_fullPolygon;
-    Polygon m_interiorPolygon;
-    QMap<Direction, Polygon> m_wallPolygons;
-    QVector<Polygon> m_cornerPolygons;
-
-    void initFullPolygon(int mazeWidth, int mazeHeight);
-    void initInteriorPolygon(int mazeWidth, int mazeHeight);
-    void initWallPolygons(int mazeWWidth, int mazeHeight);
-    void initCornerPolygons(int mazeWWidth, int mazeHeight);
+    // The edges of the full and interior rectangles of the tile
+    struct Bounds {
+        Distance outerLeft;
+        Distance outerBottom;
+        Distance outerRight;
+        Distance outerTop;
+        Distance innerLeft;
+        Distance innerBottom;
+        Distance innerRight;
+        Distance innerTop;
+    };
+    Bounds getBounds() const;
 };
 
 } // namespace mms
@@ -91,52 +91,20 @@ void TileGraphic::setTileTextVisible(bool visible) {
 
 void TileGraphic::drawPolygons() const {
 
-    // Note that the order in which we call insertIntoGraphicCpuBuffer
-    // determines the order in which the polygons are drawn. Also note that the
-    // *StartingIndex methods in GrahicsUtilities.h depend upon this order.
-
-    // Draw the base of the tile
-    m_bufferInterface->insertIntoGraphicCpuBuffer(
-        m_tile->getFullPolygon(),
-        m_tileColorsVisible
-            ? m_color
-            : STRING_TO_COLOR().value(P()->tileBaseColor()),
-        1.0);
-
-    // Draw each of the walls of the tile
-    for (Direction direction : DIRECTIONS()) {
-        QPair<Color, float> colorAndAlpha = deduceWallColorAndAlpha(direction);
-        m_bufferInterface->insertIntoGraphicCpuBuffer(
-            m_tile->getWallPolygon(direction),
-            colorAndAlpha.first,
-            colorAndAlpha.second);
-    }
-
-    // Draw the corners of the tile
-    for (Polygon polygon : m_tile->getCornerPolygons()) {
-        m_bufferInterface->insertIntoGraphicCpuBuffer(
-            polygon,
-            STRING_TO_COLOR().value(P()->tileCornerColor()),
-            1.0);
-    }
-
-    // Draw the fog
-    m_bufferInterface->insertIntoGraphicCpuBuffer(
-        m_tile->getFullPolygon(),
-        STRING_TO_COLOR().value(P()->tileFogColor()),
-        m_foggy && m_tileFogVisible ? P()->tileFogAlpha() : 0.0);
+    // The positions of the polygons are shared by all views of the maze (see
+    // MazeGeometry), so drawing a tile only requires setting its colors
+    updateColor();
+    updateWalls();
+    m_bufferInterface->updateTileGraphicCornerColor(
+        m_tile->getX(),
+        m_tile->getY(),
+        STRING_TO_COLOR().value(P()->tileCornerColor()));
+    updateFog();
 }
 
 void TileGraphic::drawTextures() {
-    // Insert all of the triangle texture objects into the buffer ...
-    QPair<int, int> maxRowsAndCols =
-        m_bufferInterface->getTileGraphicTextMaxSize();
-    for (int row = 0; row < maxRowsAndCols.first; row += 1) {
-        for (int col = 0; col < maxRowsAndCols.second; col += 1) {
-            m_bufferInterface->insertIntoTextureCpuBuffer();
-        }
-    }
-    // ... and then populate those triangle texture objects with data
+    // The triangle texture objects have already been allocated,
+    // so all we have to do is populate them with data
     updateText();
 }
 
@@ -159,6 +127,7 @@ void TileGraphic::updateFog() const {
     m_bufferInterface->updateTileGraphicFog(
         m_tile->getX(),
         m_tile->getY(),
+        STRING_TO_COLOR().value(P()->tileFogColor()),
         m_foggy && m_tileFogVisible ? P()->tileFogAlpha() : 0.0);
 }
 
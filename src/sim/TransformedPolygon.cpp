@@ -0,0 +1,74 @@
+#include "TransformedPolygon.h"
+
+#include "units/Distance.h"
+
+namespace mms {
+
+TransformedPolygon::TransformedPolygon() {
+}
+
+TransformedPolygon::TransformedPolygon(
+        const Polygon& polygon,
+        const AffineTransform& transform) :
+    m_polygon(polygon),
+    m_transform(transform) {
+}
+
+const Polygon& TransformedPolygon::getPolygon() const {
+    return m_polygon;
+}
+
+const AffineTransform& TransformedPolygon::getTransform() const {
+    return m_transform;
+}
+
+TransformedPolygon TransformedPolygon::transformed(
+        const AffineTransform& transform) const {
+    return TransformedPolygon(m_polygon, m_transform.then(transform));
+}
+
+int TransformedPolygon::size() const {
+    return m_polygon.size();
+}
+
+double TransformedPolygon::getX(int index) const {
+    return m_transform.mapX(m_polygon.getX(index), m_polygon.getY(index));
+}
+
+double TransformedPolygon::getY(int index) const {
+    return m_transform.mapY(m_polygon.getX(index), m_polygon.getY(index));
+}
+
+QVector<Coordinate> TransformedPolygon::getVertices() const {
+    QVector<Coordinate> vertices;
+    vertices.reserve(size());
+    for (int i = 0; i < size(); i += 1) {
+        vertices.append(Coordinate::Cartesian(
+            Distance::Meters(getX(i)),
+            Distance::Meters(getY(i))));
+    }
+    return vertices;
+}
+
+const QVector<int>& TransformedPolygon::getTriangulation() const {
+    return m_polygon.getTriangulation();
+}
+
+Polygon TransformedPolygon::toPolygon() const {
+    std::shared_ptr<Polygon::Data> data = std::make_shared<Polygon::Data>();
+    data->xs.reserve(size());
+    data->ys.reserve(size());
+    for (int i = 0; i < size(); i += 1) {
+        data->xs.append(getX(i));
+        data->ys.append(getY(i));
+    }
+    const QVector<int>& triangulation = m_polygon.getTriangulation();
+    std::call_once(data->triangulated, [&data, &triangulation]() {
+        data->triangulation = triangulation;
+    });
+    Polygon polygon;
+    polygon.m_data = data;
+    return polygon;
+}
+
+} // namespace mms
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <QVector>
+
+#include "AffineTransform.h"
+#include "Polygon.h"
+#include "units/Coordinate.h"
+
+namespace mms {
+
+// A lightweight view of a polygon with an affine transformation applied to
+// it. Creating, copying, and composing views never copies the vertices or
+// re-triangulates; the vertices are mapped through the matrix as they're read.
+class TransformedPolygon {
+
+public:
+
+    TransformedPolygon();
+    TransformedPolygon(const Polygon& polygon, const AffineTransform& transform);
+
+    const Polygon& getPolygon() const;
+    const AffineTransform& getTransform() const;
+
+    // The same polygon, with the other transformation applied after this one
+    TransformedPolygon transformed(const AffineTransform& transform) const;
+
+    // The transformed vertices, and the (shared) triangulation
+    int size() const;
+    double getX(int index) const;
+    double getY(int index) const;
+    QVector<Coordinate> getVertices() const;
+    const QVector<int>& getTriangulation() const;
+
+    // Copies the transformed vertices into a standalone polygon, which reuses
+    // the triangulation of the original polygon rather than recomputing it
+    Polygon toPolygon() const;
+
+private:
+
+    Polygon m_polygon;
+    AffineTransform m_transform;
+
+};
+
+} // namespace mms
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "VertexColor.h"
+
+namespace mms {
+
+struct TriangleColor {
+    VertexColor p1;
+    VertexColor p2;
+    VertexColor p3;
+};
+
+} // namespace mms
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "VertexPosition.h"
+
+namespace mms {
+
+struct TrianglePosition {
+    VertexPosition p1;
+    VertexPosition p2;
+    VertexPosition p3;
+};
+
+} // namespace mms
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "RGB.h"
+
+namespace mms {
+
+struct VertexColor {
+    RGB rgb;  // rgb values
+    double a; // alpha value
+};
+
+} // namespace mms
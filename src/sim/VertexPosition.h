@@ -0,0 +1,10 @@
+#pragma once
+
+namespace mms {
+
+struct VertexPosition {
+    double x; // x position
+    double y; // y position
+};
+
+} // namespace mms
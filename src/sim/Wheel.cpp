@@ -3,6 +3,8 @@
 #include <QVector>
 #include <QtMath>
 
+#include "TransformedPolygon.h"
+
 namespace mms {
 
 Wheel::Wheel() :
@@ -11,6 +13,7 @@ Wheel::Wheel() :
     m_unitTurnEffect(AngularVelocity()),
     m_maximumSpeed(AngularVelocity()),
     m_currentSpeed(AngularVelocity()),
+    m_targetSpeed(AngularVelocity()),
     m_encoderTicksPerRevolution(0),
     m_absoluteRotation(Angle()),
     m_relativeRotation(Angle()) {
@@ -24,13 +27,18 @@ Wheel::Wheel(
     const Distance& diameter,
     const Distance& width,
     const AngularVelocity& maximumSpeed,
+    const Motor& motor,
     EncoderType encoderType,
-    double encoderTicksPerRevolution
+    double encoderTicksPerRevolution,
+    const Noise& encoderNoise
 ) :
     m_maximumSpeed(maximumSpeed),
     m_currentSpeed(AngularVelocity::RadiansPerSecond(0.0)),
+    m_targetSpeed(AngularVelocity::RadiansPerSecond(0.0)),
+    m_motor(motor),
     m_encoderType(encoderType),
     m_encoderTicksPerRevolution(encoderTicksPerRevolution),
+    m_encoderNoise(encoderNoise),
     m_absoluteRotation(Angle::Radians(0)),
     m_relativeRotation(Angle::Radians(0)
 ) {
@@ -42,9 +50,9 @@ Wheel::Wheel(
     polygon.push_back(Coordinate::Cartesian(radius *  1, halfWidth * -1));
     polygon.push_back(Coordinate::Cartesian(radius *  1, halfWidth *  1));
     polygon.push_back(Coordinate::Cartesian(radius * -1, halfWidth *  1));
-    m_initialPolygon = Polygon(polygon)
-        .translate(wheelPosition)
-        .rotateAroundPoint(wheelDirection, wheelPosition);
+    m_initialPolygon = Polygon(polygon).transformed(
+        AffineTransform::Translation(wheelPosition).then(
+        AffineTransform::Rotation(wheelDirection, wheelPosition))).toPolygon();
 
     // Calculate the effects of this wheel on the mouse
     AngularVelocity oneRadianPerSecond = AngularVelocity::RadiansPerSecond(1.0);
@@ -70,11 +78,24 @@ WheelEffect Wheel::getMaximumEffect() const {
     return getEffect(getMaximumSpeed());
 }
 
-WheelEffect Wheel::update(const Duration& elapsed) {
-    Angle angle = m_currentSpeed * elapsed;
+QPair<WheelEffect, WheelEffect> Wheel::update(const Duration& elapsed) {
+
+    // NOTE: This is a performance critical function
+
+    // The speed changes linearly over the step, so the rotation of the wheel
+    // is given by the average of the speeds at the start and end of the step
+    AngularVelocity startSpeed = m_currentSpeed;
+    if (m_motor.isIdeal()) {
+        m_currentSpeed = m_targetSpeed;
+        startSpeed = m_targetSpeed;
+    }
+    else {
+        m_currentSpeed = m_motor.getNextSpeed(m_currentSpeed, m_targetSpeed, elapsed);
+    }
+    Angle angle = (startSpeed + m_currentSpeed) / 2.0 * elapsed;
     m_absoluteRotation += angle;
     m_relativeRotation += angle;
-    return getEffect(m_currentSpeed);
+    return {getEffect(startSpeed), getEffect(m_currentSpeed)};
 }
 
 const AngularVelocity& Wheel::getMaximumSpeed() const {
@@ -85,11 +106,20 @@ const AngularVelocity& Wheel::getCurrentSpeed() const {
     return m_currentSpeed;
 }
 
+const AngularVelocity& Wheel::getTargetSpeed() const {
+    return m_targetSpeed;
+}
+
 void Wheel::setSpeed(const AngularVelocity& speed) {
     ASSERT_LE(
         std::abs(speed.getRevolutionsPerMinute()),
         m_maximumSpeed.getRevolutionsPerMinute());
-    m_currentSpeed = speed;
+    m_targetSpeed = speed;
+}
+
+void Wheel::stop() {
+    m_currentSpeed = AngularVelocity::RadiansPerSecond(0.0);
+    m_targetSpeed = AngularVelocity::RadiansPerSecond(0.0);
 }
 
 EncoderType Wheel::getEncoderType() const {
@@ -100,6 +130,10 @@ double Wheel::getEncoderTicksPerRevolution() const {
     return m_encoderTicksPerRevolution;
 }
 
+const Noise& Wheel::getEncoderNoise() const {
+    return m_encoderNoise;
+}
+
 int Wheel::readAbsoluteEncoder() const {
     return static_cast<int>(std::floor(
         m_encoderTicksPerRevolution *
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <QPair>
+
 #include "EncoderType.h"
+#include "Motor.h"
+#include "Noise.h"
 #include "Polygon.h"
 #include "WheelEffect.h"
 
@@ -24,22 +28,30 @@ public:
         const Distance& diameter,
         const Distance& width,
         const AngularVelocity& maximumSpeed,
+        const Motor& motor,
         EncoderType encoderType,
-        double encoderTicksPerRevolution);
+        double encoderTicksPerRevolution,
+        const Noise& encoderNoise);
 
     // Wheel
     const Polygon& getInitialPolygon() const;
     WheelEffect getMaximumEffect() const;
-    WheelEffect update(const Duration& elapsed);
+
+    // Advances the speed of the wheel toward the target speed, as allowed by
+    // the motor, and returns the effects at the start and end of the step
+    QPair<WheelEffect, WheelEffect> update(const Duration& elapsed);
 
     // Motor
     const AngularVelocity& getMaximumSpeed() const;
     const AngularVelocity& getCurrentSpeed() const;
+    const AngularVelocity& getTargetSpeed() const;
     void setSpeed(const AngularVelocity& speed);
+    void stop();
 
     // Encoder
     EncoderType getEncoderType() const;
     double getEncoderTicksPerRevolution() const;
+    const Noise& getEncoderNoise() const;
     int readAbsoluteEncoder() const;
     int readRelativeEncoder() const;
     void resetRelativeEncoder();
@@ -58,10 +70,13 @@ private:
     // Motor
     AngularVelocity m_maximumSpeed;
     AngularVelocity m_currentSpeed;
+    AngularVelocity m_targetSpeed;
+    Motor m_motor;
 
     // Encoder
     EncoderType m_encoderType;
     double m_encoderTicksPerRevolution;
+    Noise m_encoderNoise;
     Angle m_absoluteRotation;
     Angle m_relativeRotation;
 
@@ -10,15 +10,18 @@
 #include <QMenuBar>
 #include <QMessageBox>
 #include <QSplitter>
+#include <QStringList>
 #include <QTabWidget>
 #include <QTimer>
 #include <QVBoxLayout>
 
 #include "ConfigDialog.h"
+#include "MazeChecker.h"
 #include "MazeFilesTab.h"
 #include "Model.h"
 #include "Param.h"
 #include "ProcessUtilities.h"
+#include "ReferencePathSolver.h"
 #include "Resources.h"
 #include "SettingsMazeAlgos.h"
 #include "SettingsMouseAlgos.h"
@@ -44,12 +47,15 @@ Window::Window(QWidget *parent) :
         m_fogCheckbox(new QCheckBox("Fog")),
         m_textCheckbox(new QCheckBox("Text")),
         m_followCheckbox(new QCheckBox("Follow")),
+        m_renderStatsCheckbox(new QCheckBox("Stats")),
         m_maze(nullptr),
+        m_mazeGeometry(nullptr),
         m_truth(nullptr),
         m_mouse(nullptr),
         m_mouseGraphic(nullptr),
         m_view(nullptr),
         m_mouseInterface(nullptr),
+        m_frameExporter(nullptr),
         m_mouseAlgoThread(nullptr),
 
         // MazeAlgosTab
@@ -145,6 +151,7 @@ Window::Window(QWidget *parent) :
     mapOptionsLayout->addWidget(m_fogCheckbox);
     mapOptionsLayout->addWidget(m_textCheckbox);
     mapOptionsLayout->addWidget(m_followCheckbox);
+    mapOptionsLayout->addWidget(m_renderStatsCheckbox);
 
     // Add functionality to those map buttons
     connect(m_viewButton, &QRadioButton::toggled, this, [=](bool checked){
@@ -189,6 +196,10 @@ Window::Window(QWidget *parent) :
         }
     });
 
+    connect(m_renderStatsCheckbox, &QCheckBox::stateChanged, this, [=](int state){
+        m_map.setRenderStatsEnabled(state == Qt::Checked);
+    });
+
     // Set the default values for the map options
     m_truthButton->setChecked(true);
     m_distancesCheckbox->setChecked(true);
@@ -204,6 +215,7 @@ Window::Window(QWidget *parent) :
     m_textCheckbox->setEnabled(false);
     m_followCheckbox->setChecked(false);
     m_followCheckbox->setEnabled(false);
+    m_renderStatsCheckbox->setChecked(false);
 
     // Add the tabs to the splitter
     QTabWidget* tabWidget = new QTabWidget();
@@ -319,6 +331,9 @@ Window::Window(QWidget *parent) :
                 return;
             }
             m_map.update();
+            if (m_frameExporter != nullptr) {
+                m_frameExporter->update(m_view, m_mouseGraphic);
+            }
             then = now;
         }
     );
@@ -373,10 +388,13 @@ void Window::setMaze(Maze* maze) {
 
     // Next, update the maze and truth
     Maze* oldMaze = m_maze;
+    MazeGeometry* oldMazeGeometry = m_mazeGeometry;
     MazeView* oldTruth = m_truth;
     m_maze = maze;
+    m_mazeGeometry = new MazeGeometry(m_maze);
     m_truth = new MazeView(
         m_maze,
+        m_mazeGeometry,
         true, // wallTruthVisible
         false, // tileColorsVisible
         false, // tileFogVisible
@@ -401,8 +419,17 @@ void Window::setMaze(Maze* maze) {
     m_isValidLabel->setText(m_maze->isValidMaze() ? "TRUE" : "FALSE");
     m_isOfficialLabel->setText(m_maze->isOfficialMaze() ? "TRUE" : "FALSE");
 
+    // Explain why the maze isn't valid or official on mouse over
+    QStringList failedRules;
+    for (const QString& rule : MazeChecker::getFailedRules(m_maze->getCheckReport())) {
+        failedRules.append(rule);
+    }
+    m_isValidLabel->setToolTip(failedRules.join("\n"));
+    m_isOfficialLabel->setToolTip(failedRules.join("\n"));
+
     // Delete the old objects
     delete oldMaze;
+    delete oldMazeGeometry;
     delete oldTruth;
 }
 
@@ -682,6 +709,8 @@ QPair<QStringList, QVector<QVariant>> Window::getRunStats() const {
         "Elapsed Sim Time",
         "Time Since Origin Departure",
         "Best Time to Center",
+        "Reference Time to Center",
+        "% of Optimal",
         "Crashed",
     };
 
@@ -720,6 +749,18 @@ QPair<QStringList, QVector<QVariant>> Window::getRunStats() const {
             ? "NONE"
             : SimUtilities::formatDuration(stats.bestTimeToCenter)
         );
+        values.append(
+            m_referencePath.isReachable
+            ? SimUtilities::formatDuration(m_referencePath.timeToCenter)
+            : "NONE"
+        );
+        values.append(
+            stats.bestTimeToCenter.getSeconds() <= 0 || !m_referencePath.isReachable
+            ? "NONE"
+            : QString::number(
+                100.0 * m_referencePath.timeToCenter.getSeconds() /
+                stats.bestTimeToCenter.getSeconds(), 'f', 1)
+        );
         values.append((m_mouse->didCrash() ? "TRUE" : "FALSE"));
     }
 
@@ -1498,6 +1539,7 @@ void Window::mouseAlgoRunStart() {
     // Create some more objects
     MazeView* newView = new MazeView(
         m_maze,
+        m_mazeGeometry,
         m_wallTruthCheckbox->isChecked(),
         m_colorCheckbox->isChecked(),
         m_fogCheckbox->isChecked(),
@@ -1557,6 +1599,22 @@ void Window::mouseAlgoRunStart() {
             }
         );
 
+        // The reference path has to move at the same fraction of the max
+        // wheel speeds as the algorithm, which it may only set once running
+        connect(
+            newMouseInterface,
+            &MouseInterface::wheelSpeedFractionChanged,
+            this,
+            [=](double wheelSpeedFraction){
+                if (m_mouse == newMouse) {
+                    m_referencePath = ReferencePathSolver::solve(
+                        m_maze,
+                        newMouse,
+                        wheelSpeedFraction);
+                }
+            }
+        );
+
         // Process all stderr commands as appropriate
         connect(
             newProcess,
@@ -1704,6 +1762,10 @@ void Window::mouseAlgoRunStart() {
         // Update the member variables because, at this
         // point, the algorithm started successfully
         m_mouse = newMouse;
+        m_referencePath = ReferencePathSolver::solve(
+            m_maze,
+            newMouse,
+            newMouseInterface->getWheelSpeedFraction());
         m_view = newView;
         m_mouseGraphic = newMouseGraphic;
         m_mouseInterface = newMouseInterface;
@@ -1712,6 +1774,17 @@ void Window::mouseAlgoRunStart() {
         m_map.setView(newView);
         m_map.setMouseGraphic(newMouseGraphic);
 
+        // Export frames of the run, if a directory was configured
+        if (!P()->frameExportDirectory().isEmpty()) {
+            m_frameExporter = new FrameExporter(
+                m_maze,
+                P()->frameExportDirectory(),
+                Duration::Seconds(P()->frameExportInterval()),
+                Duration::Milliseconds(P()->frameExportBudget()),
+                {P()->frameExportWidth(), P()->frameExportHeight()}
+            );
+        }
+
         // We have to do some gymnastics here (similar to above)
         // to ensure that the UI updates happen on the UI thread
         connect(
@@ -1766,6 +1839,13 @@ void Window::mouseAlgoRunStop() {
         m_mouseAlgoRunStatus->setText("CANCELED");
     }
 
+    // Write the final explored view and truth before the mouse goes away
+    if (m_frameExporter != nullptr) {
+        m_frameExporter->snapshot(m_view, m_truth, m_mouseGraphic);
+        delete m_frameExporter;
+        m_frameExporter = nullptr;
+    }
+
     // Regardless of whether or not an algo is running, put the Window in a
     // "mouseless" state (note that the objects themselves get deleted in a
     // separate callback). Note that we do this *after* stopping the algo
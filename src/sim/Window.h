@@ -12,14 +12,17 @@
 #include <QThread>
 
 #include "ConfigDialogField.h"
+#include "FrameExporter.h"
 #include "Map.h"
 #include "Maze.h"
+#include "MazeGeometry.h"
 #include "MazeView.h"
 #include "Model.h"
 #include "MouseAlgoStatsWidget.h"
 #include "MouseGraphic.h"
 #include "MouseInterface.h"
 #include "RandomSeedWidget.h"
+#include "ReferencePath.h"
 
 namespace mms {
 
@@ -68,9 +71,12 @@ private:
     QCheckBox* m_fogCheckbox;
     QCheckBox* m_textCheckbox;
     QCheckBox* m_followCheckbox;
+    QCheckBox* m_renderStatsCheckbox;
 
-    // The maze and the true view of the maze
+    // The maze, the geometry shared by all of its views,
+    // and the true view of the maze
     Maze* m_maze;
+    MazeGeometry* m_mazeGeometry;
     MazeView* m_truth;
 
     // The mouse, its graphic, its view of the maze, and the controller
@@ -80,6 +86,12 @@ private:
     MazeView* m_view;
     MouseInterface* m_mouseInterface;
 
+    // The time-optimal path for the current mouse in the current maze
+    ReferencePath m_referencePath;
+
+    // Renders frames of the current run offscreen, if configured
+    FrameExporter* m_frameExporter;
+
     // Helper function for updating the maze 
     void setMaze(Maze* maze);
 
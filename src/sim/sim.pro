@@ -1,16 +1,25 @@
 QT += core
 QT += gui
 QT += xml
+QT += concurrent
 QT += widgets
 
 TEMPLATE = app
 
+CONFIG += c++14
 CONFIG += debug
 CONFIG += object_parallel_to_source
 CONFIG += qt
 
 SOURCES += $$files(*.cpp, true)
 HEADERS += $$files(*.h, true)
+
+# The built-in maze generators, which MazeGenerator runs in-process
+SOURCES += ../maze/algos/random_c++/Algo.cpp
+SOURCES += ../maze/algos/random_c++/Interface.cpp
+SOURCES += ../maze/algos/tomasz/Algo.cpp
+SOURCES += ../maze/algos/tomasz/Interface.cpp
+
 RESOURCES = resources.qrc
 
 DESTDIR     = ../../bin
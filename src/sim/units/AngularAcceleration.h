@@ -0,0 +1,64 @@
+#pragma once
+
+#include <QtMath>
+
+#include "AngularVelocity.h"
+#include "Duration.h"
+
+namespace mms {
+
+class AngularAcceleration {
+
+public:
+
+    constexpr AngularAcceleration();
+    static constexpr AngularAcceleration RadiansPerSecondSquared(double radiansPerSecondSquared);
+    static constexpr AngularAcceleration RevolutionsPerMinutePerSecond(double revolutionsPerMinutePerSecond);
+
+    constexpr double getRadiansPerSecondSquared() const;
+    constexpr double getRevolutionsPerMinutePerSecond() const;
+
+    constexpr AngularVelocity operator*(const Duration& duration) const;
+
+private:
+
+    double m_radiansPerSecondSquared;
+    constexpr AngularAcceleration(double radiansPerSecondSquared);
+
+};
+
+constexpr AngularAcceleration::AngularAcceleration() : AngularAcceleration(0.0) {
+}
+
+constexpr AngularAcceleration AngularAcceleration::RadiansPerSecondSquared(
+    double radiansPerSecondSquared) {
+    return AngularAcceleration(radiansPerSecondSquared);
+}
+
+constexpr AngularAcceleration AngularAcceleration::RevolutionsPerMinutePerSecond(
+    double revolutionsPerMinutePerSecond) {
+    constexpr double minutesPerSecond = 1.0 / 60.0;
+    constexpr double radiansPerRevolution = 2 * M_PI;
+    return AngularAcceleration(
+        radiansPerRevolution * revolutionsPerMinutePerSecond * minutesPerSecond);
+}
+
+constexpr double AngularAcceleration::getRadiansPerSecondSquared() const {
+    return m_radiansPerSecondSquared;
+}
+
+constexpr double AngularAcceleration::getRevolutionsPerMinutePerSecond() const {
+    constexpr double revolutionsPerRadian = 1.0 / (2 * M_PI);
+    constexpr double secondsPerMinute = 60.0;
+    return revolutionsPerRadian * m_radiansPerSecondSquared * secondsPerMinute;
+}
+
+constexpr AngularVelocity AngularAcceleration::operator*(const Duration& duration) const {
+    return AngularVelocity::RadiansPerSecond(m_radiansPerSecondSquared * duration.getSeconds());
+}
+
+constexpr AngularAcceleration::AngularAcceleration(double radiansPerSecondSquared) :
+    m_radiansPerSecondSquared(radiansPerSecondSquared) {
+}
+
+} // namespace mms
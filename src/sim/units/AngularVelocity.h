@@ -1,5 +1,8 @@
 #pragma once
 
+#include <QtMath>
+
+#include "../Assert.h"
 #include "Angle.h"
 #include "Duration.h"
 #include "Speed.h"
@@ -10,30 +13,106 @@ class AngularVelocity {
 
 public:
 
-    AngularVelocity();
-    static AngularVelocity DegreesPerSecond(double degreesPerSecond);
-    static AngularVelocity RadiansPerSecond(double radiansPerSecond);
-    static AngularVelocity RevolutionsPerMinute(double revolutionsPerMinute);
-
-    double getRadiansPerSecond() const;
-    double getDegreesPerSecond() const;
-    double getRevolutionsPerMinute() const;
-
-    AngularVelocity operator*(double factor) const;
-    AngularVelocity operator/(double factor) const;
-    AngularVelocity operator+(const AngularVelocity& other) const;
-    AngularVelocity operator-(const AngularVelocity& other) const;
-    Angle operator*(const Duration& duration) const;
-    Speed operator*(const Distance& radius) const;
-    void operator+=(const AngularVelocity& other);
-    bool operator<(const AngularVelocity& other) const;
-    bool operator<=(const AngularVelocity& other) const;
+    constexpr AngularVelocity();
+    static constexpr AngularVelocity DegreesPerSecond(double degreesPerSecond);
+    static constexpr AngularVelocity RadiansPerSecond(double radiansPerSecond);
+    static constexpr AngularVelocity RevolutionsPerMinute(double revolutionsPerMinute);
+
+    constexpr double getRadiansPerSecond() const;
+    constexpr double getDegreesPerSecond() const;
+    constexpr double getRevolutionsPerMinute() const;
+
+    constexpr AngularVelocity operator*(double factor) const;
+    constexpr AngularVelocity operator/(double factor) const;
+    constexpr AngularVelocity operator+(const AngularVelocity& other) const;
+    constexpr AngularVelocity operator-(const AngularVelocity& other) const;
+    constexpr Angle operator*(const Duration& duration) const;
+    constexpr Speed operator*(const Distance& radius) const;
+    constexpr void operator+=(const AngularVelocity& other);
+    constexpr bool operator<(const AngularVelocity& other) const;
+    constexpr bool operator<=(const AngularVelocity& other) const;
 
 private:
 
     double m_radiansPerSecond;
-    AngularVelocity(double radiansPerSecond);
+    constexpr AngularVelocity(double radiansPerSecond);
 
 };
 
+constexpr AngularVelocity::AngularVelocity() : AngularVelocity(0.0) {
+}
+
+constexpr AngularVelocity AngularVelocity::RadiansPerSecond(double radiansPerSecond) {
+    return AngularVelocity(radiansPerSecond);
+}
+
+constexpr AngularVelocity AngularVelocity::DegreesPerSecond(double degreesPerSecond) {
+    constexpr double radiansPerDegree = 2 * M_PI / 360.0;
+    return AngularVelocity(radiansPerDegree * degreesPerSecond);
+}
+
+constexpr AngularVelocity AngularVelocity::RevolutionsPerMinute(
+    double revolutionsPerMinute) {
+    constexpr double minutesPerSecond = 1.0 / 60.0;
+    constexpr double radiansPerRevolution = 2 * M_PI;
+    return AngularVelocity(
+        radiansPerRevolution * revolutionsPerMinute * minutesPerSecond);
+}
+
+constexpr double AngularVelocity::getRadiansPerSecond() const {
+    return m_radiansPerSecond;
+}
+
+constexpr double AngularVelocity::getDegreesPerSecond() const {
+    constexpr double degreesPerRadian = 360.0 / (2 * M_PI);
+    return degreesPerRadian * m_radiansPerSecond;
+}
+
+constexpr double AngularVelocity::getRevolutionsPerMinute() const {
+    constexpr double revolutionsPerRadian = 1.0 / (2 * M_PI);
+    constexpr double secondsPerMinute = 60.0;
+    return revolutionsPerRadian * m_radiansPerSecond * secondsPerMinute;
+}
+
+constexpr AngularVelocity AngularVelocity::operator*(double factor) const {
+    return AngularVelocity(m_radiansPerSecond * factor);
+}
+
+constexpr AngularVelocity AngularVelocity::operator/(double factor) const {
+    ASSERT_NE(factor, 0.0);
+    return AngularVelocity(m_radiansPerSecond / factor);
+}
+
+constexpr AngularVelocity AngularVelocity::operator+(const AngularVelocity& other) const {
+    return AngularVelocity(m_radiansPerSecond + other.m_radiansPerSecond);
+}
+
+constexpr AngularVelocity AngularVelocity::operator-(const AngularVelocity& other) const {
+    return AngularVelocity(m_radiansPerSecond - other.m_radiansPerSecond);
+}
+
+constexpr Angle AngularVelocity::operator*(const Duration& duration) const {
+    return Angle::Radians(m_radiansPerSecond * duration.getSeconds());
+}
+
+constexpr Speed AngularVelocity::operator*(const Distance& radius) const {
+    return Speed::MetersPerSecond(m_radiansPerSecond * radius.getMeters());
+}
+
+constexpr void AngularVelocity::operator+=(const AngularVelocity& other) {
+    m_radiansPerSecond += other.m_radiansPerSecond;
+}
+
+constexpr bool AngularVelocity::operator<(const AngularVelocity& other) const {
+    return m_radiansPerSecond < other.m_radiansPerSecond;
+}
+
+constexpr bool AngularVelocity::operator<=(const AngularVelocity& other) const {
+    return m_radiansPerSecond <= other.m_radiansPerSecond;
+}
+
+constexpr AngularVelocity::AngularVelocity(double radiansPerSecond) :
+    m_radiansPerSecond(radiansPerSecond) {
+}
+
 } // namespace mms
@@ -6,20 +6,46 @@ class Area {
 
 public:
 
-    Area();
-    static Area MetersSquared(double metersSquared);
+    constexpr Area();
+    static constexpr Area MetersSquared(double metersSquared);
 
-    double getMetersSquared() const;
+    constexpr double getMetersSquared() const;
 
-    Area operator*(double factor) const;
-    Area operator+(const Area& area) const;
-    Area operator-(const Area& area) const;
+    constexpr Area operator*(double factor) const;
+    constexpr Area operator+(const Area& area) const;
+    constexpr Area operator-(const Area& area) const;
 
 private:
 
     double m_metersSquared;
-    Area(double metersSquared);
+    constexpr Area(double metersSquared);
 
 };
 
+constexpr Area::Area() : Area(0.0) {
+}
+
+constexpr Area Area::MetersSquared(double metersSquared) {
+    return Area(metersSquared);
+}
+
+constexpr double Area::getMetersSquared() const {
+    return m_metersSquared;
+}
+
+constexpr Area Area::operator*(double factor) const {
+    return Area(m_metersSquared * factor);
+}
+
+constexpr Area Area::operator+(const Area& other) const {
+    return Area(m_metersSquared + other.m_metersSquared);
+}
+
+constexpr Area Area::operator-(const Area& other) const {
+    return Area(m_metersSquared - other.m_metersSquared);
+}
+
+constexpr Area::Area(double metersSquared) : m_metersSquared(metersSquared) {
+}
+
 } // namespace mms
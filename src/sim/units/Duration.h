@@ -6,26 +6,80 @@ class Duration {
 
 public:
 
-    Duration();
-    static Duration Seconds(double seconds);
-    static Duration Milliseconds(double milliseconds);
-    static Duration Microseconds(double microseconds);
+    constexpr Duration();
+    static constexpr Duration Seconds(double seconds);
+    static constexpr Duration Milliseconds(double milliseconds);
+    static constexpr Duration Microseconds(double microseconds);
 
-    double getSeconds() const;
-    double getMilliseconds() const;
-    double getMicroseconds() const;
+    constexpr double getSeconds() const;
+    constexpr double getMilliseconds() const;
+    constexpr double getMicroseconds() const;
 
-    Duration operator*(double factor) const;
-    Duration operator+(const Duration& other) const;
-    Duration operator-(const Duration& other) const;
-    bool operator<(const Duration& other) const;
-    void operator+=(const Duration& other);
+    constexpr Duration operator*(double factor) const;
+    constexpr Duration operator+(const Duration& other) const;
+    constexpr Duration operator-(const Duration& other) const;
+    constexpr bool operator<(const Duration& other) const;
+    constexpr void operator+=(const Duration& other);
 
 private:
 
     double m_seconds;
-    Duration(double seconds);
+    constexpr Duration(double seconds);
 
 };
 
+constexpr Duration::Duration() : Duration(0.0) {
+}
+
+constexpr Duration Duration::Seconds(double seconds) {
+    return Duration(seconds);
+}
+
+constexpr Duration Duration::Milliseconds(double milliseconds) {
+    constexpr double secondsPerMillisecond = 1.0 / 1000.0;
+    return Duration(secondsPerMillisecond * milliseconds);
+}
+
+constexpr Duration Duration::Microseconds(double microseconds) {
+    constexpr double secondsPerMicrosecond = 1.0 / 1000.0 / 1000.0;
+    return Duration(secondsPerMicrosecond * microseconds);
+}
+
+constexpr double Duration::getSeconds() const {
+    return m_seconds;
+}
+
+constexpr double Duration::getMilliseconds() const {
+    constexpr double millisecondsPerSecond = 1000.0;
+    return millisecondsPerSecond * m_seconds;
+}
+
+constexpr double Duration::getMicroseconds() const {
+    constexpr double microsecondsPerSecond = 1000.0 * 1000.0;
+    return microsecondsPerSecond * m_seconds;
+}
+
+constexpr Duration Duration::operator*(double factor) const {
+    return Duration(m_seconds * factor);
+}
+
+constexpr Duration Duration::operator+(const Duration& other) const {
+    return Duration(m_seconds + other.m_seconds);
+}
+
+constexpr Duration Duration::operator-(const Duration& other) const {
+    return Duration(m_seconds - other.m_seconds);
+}
+
+constexpr bool Duration::operator<(const Duration& other) const {
+    return m_seconds < other.m_seconds;
+}
+
+constexpr void Duration::operator+=(const Duration& other) {
+    m_seconds += other.m_seconds;
+}
+
+constexpr Duration::Duration(double seconds) : m_seconds(seconds) {
+}
+
 } // namespace mms
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Angle.h"
+#include "Coordinate.h"
+#include "Distance.h"
+
+namespace mms {
+
+// An angle together with its sine and cosine, which are computed once, when
+// the rotation is created, rather than on every use. Composing two rotations
+// uses the angle sum identities and so doesn't compute any trig either.
+class Rotation {
+
+public:
+
+    // The identity rotation
+    constexpr Rotation();
+    explicit Rotation(const Angle& angle);
+
+    constexpr const Angle& getAngle() const;
+    constexpr double getSin() const;
+    constexpr double getCos() const;
+
+    // Rotates a vector (about the origin) by this rotation
+    constexpr Coordinate rotate(const Coordinate& vector) const;
+
+    constexpr Rotation operator+(const Rotation& other) const;
+    constexpr Rotation operator-(const Rotation& other) const;
+
+private:
+
+    Angle m_angle;
+    double m_sin;
+    double m_cos;
+    constexpr Rotation(const Angle& angle, double sin, double cos);
+
+};
+
+constexpr Rotation::Rotation() : Rotation(Angle(), 0.0, 1.0) {
+}
+
+inline Rotation::Rotation(const Angle& angle) :
+    Rotation(angle, angle.getSin(), angle.getCos()) {
+}
+
+constexpr const Angle& Rotation::getAngle() const {
+    return m_angle;
+}
+
+constexpr double Rotation::getSin() const {
+    return m_sin;
+}
+
+constexpr double Rotation::getCos() const {
+    return m_cos;
+}
+
+constexpr Coordinate Rotation::rotate(const Coordinate& vector) const {
+    double x = vector.getX().getMeters();
+    double y = vector.getY().getMeters();
+    return Coordinate::Cartesian(
+        Distance::Meters(m_cos * x - m_sin * y),
+        Distance::Meters(m_sin * x + m_cos * y));
+}
+
+constexpr Rotation Rotation::operator+(const Rotation& other) const {
+    return Rotation(
+        m_angle + other.m_angle,
+        m_sin * other.m_cos + m_cos * other.m_sin,
+        m_cos * other.m_cos - m_sin * other.m_sin);
+}
+
+constexpr Rotation Rotation::operator-(const Rotation& other) const {
+    return Rotation(
+        m_angle - other.m_angle,
+        m_sin * other.m_cos - m_cos * other.m_sin,
+        m_cos * other.m_cos + m_sin * other.m_sin);
+}
+
+constexpr Rotation::Rotation(const Angle& angle, double sin, double cos) :
+    m_angle(angle),
+    m_sin(sin),
+    m_cos(cos) {
+}
+
+} // namespace mms
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../Assert.h"
 #include "Distance.h"
 #include "Duration.h"
 
@@ -9,26 +10,75 @@ class Speed {
 
 public:
 
-    Speed();
-    static Speed MetersPerSecond(double metersPerSecond);
+    constexpr Speed();
+    static constexpr Speed MetersPerSecond(double metersPerSecond);
 
-    double getMetersPerSecond() const;
+    constexpr double getMetersPerSecond() const;
 
-    Speed operator*(double factor) const;
-    Speed operator/(double factor) const;
-    Speed operator+(const Speed& other) const;
-    Speed operator-(const Speed& other) const;
-    Distance operator*(const Duration& duration) const;
-    double operator/(const Speed& other) const;
-    bool operator<(const Speed& other) const;
-    void operator+=(const Speed& other);
+    constexpr Speed operator*(double factor) const;
+    constexpr Speed operator/(double factor) const;
+    constexpr Speed operator+(const Speed& other) const;
+    constexpr Speed operator-(const Speed& other) const;
+    constexpr Distance operator*(const Duration& duration) const;
+    constexpr double operator/(const Speed& other) const;
+    constexpr bool operator<(const Speed& other) const;
+    constexpr void operator+=(const Speed& other);
 
 
 private:
 
     double m_metersPerSecond;
-    Speed(double metersPerSecond);
+    constexpr Speed(double metersPerSecond);
 
 };
 
+constexpr Speed::Speed() : Speed(0.0) {
+}
+
+constexpr Speed Speed::MetersPerSecond(double metersPerSecond) {
+    return Speed(metersPerSecond);
+}
+
+constexpr double Speed::getMetersPerSecond() const {
+    return m_metersPerSecond;
+}
+
+constexpr Speed Speed::operator*(double factor) const {
+    return Speed(m_metersPerSecond * factor);
+}
+
+constexpr Speed Speed::operator/(double factor) const {
+    ASSERT_NE(factor, 0.0);
+    return Speed(m_metersPerSecond / factor);
+}
+
+constexpr Speed Speed::operator+(const Speed& other) const {
+    return Speed(m_metersPerSecond + other.m_metersPerSecond);
+}
+
+constexpr Speed Speed::operator-(const Speed& other) const {
+    return Speed(m_metersPerSecond - other.m_metersPerSecond);
+}
+
+constexpr Distance Speed::operator*(const Duration& duration) const {
+    return Distance::Meters(m_metersPerSecond * duration.getSeconds());
+}
+
+constexpr double Speed::operator/(const Speed& other) const {
+    ASSERT_NE(other.m_metersPerSecond, 0.0);
+    return m_metersPerSecond / other.m_metersPerSecond;
+}
+
+constexpr bool Speed::operator<(const Speed& other) const {
+    return m_metersPerSecond < other.m_metersPerSecond;
+}
+
+constexpr void Speed::operator+=(const Speed& other) {
+    m_metersPerSecond += other.getMetersPerSecond();
+}
+
+constexpr Speed::Speed(double metersPerSecond) :
+    m_metersPerSecond(metersPerSecond) {
+}
+
 } // namespace mms
@@ -0,0 +1,36 @@
+# Compares GeometryUtilities::castRay() against the reference algorithm it
+# replaced, both for equivalence and for speed; see main.cpp
+
+QT += core
+QT += gui
+QT += xml
+QT += concurrent
+QT += widgets
+
+TEMPLATE = app
+
+CONFIG += c++14
+CONFIG += release
+CONFIG += object_parallel_to_source
+CONFIG += qt
+
+INCLUDEPATH += ../../src/sim
+
+SOURCES += main.cpp
+
+# The benchmark needs Maze, which needs most of the simulator, so we build
+# all of it except for the simulator's own main()
+SOURCES += $$files(../../src/sim/*.cpp, true)
+SOURCES -= ../../src/sim/Main.cpp
+HEADERS += $$files(../../src/sim/*.h, true)
+SOURCES += ../../src/maze/algos/random_c++/Algo.cpp
+SOURCES += ../../src/maze/algos/random_c++/Interface.cpp
+SOURCES += ../../src/maze/algos/tomasz/Algo.cpp
+SOURCES += ../../src/maze/algos/tomasz/Interface.cpp
+
+RESOURCES = ../../src/sim/resources.qrc
+
+DESTDIR     = ../../bin
+MOC_DIR     = ../../build/moc/castray_benchmark
+OBJECTS_DIR = ../../build/obj/castray_benchmark
+RCC_DIR     = ../../build/rcc/castray_benchmark
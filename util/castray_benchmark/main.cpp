@@ -0,0 +1,276 @@
+// A micro-benchmark for GeometryUtilities::castRay(). It casts the same random
+// rays through random mazes with both castRay() and the reference algorithm
+// that it replaced (on Distance and Coordinate, with std::function dispatch),
+// checks that they hit the same points, and reports how long each one took.
+//
+// Usage: castray_benchmark [number-of-rays]
+//
+// Build it in release mode, e.g.:
+//
+//     cd util/castray_benchmark
+//     qmake
+//     make
+//     ../../bin/castray_benchmark
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QPair>
+#include <QString>
+#include <QVector>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <random>
+
+#include "BasicMaze.h"
+#include "Direction.h"
+#include "GeometryUtilities.h"
+#include "Maze.h"
+#include "MazeSymmetry.h"
+#include "Param.h"
+#include "units/Angle.h"
+#include "units/Coordinate.h"
+#include "units/Distance.h"
+
+using namespace mms;
+
+// The castRay() algorithm from before it was specialized on the direction of
+// the ray, kept verbatim (minus the comments) as the reference
+Coordinate referenceCastRay(
+    const Coordinate& start,
+    const Coordinate& end,
+    const Maze& maze,
+    const Distance& halfWallWidth,
+    const Distance& tileLength
+) {
+    Distance dx = end.getX() - start.getX();
+    Distance dy = end.getY() - start.getY();
+
+    QPair<int, int> direction = {
+        (0 < dx.getMeters() ? 1 : -1),
+        (0 < dy.getMeters() ? 1 : -1)
+    };
+
+    Coordinate logicalShift = Coordinate::Cartesian(
+        halfWallWidth * direction.first  * -1,
+        halfWallWidth * direction.second * -1
+    );
+
+    Distance cx = start.getX();
+    Distance cy = start.getY();
+
+    int sx = static_cast<int>(std::floor((start - logicalShift).getX() / tileLength));
+    int sy = static_cast<int>(std::floor((start - logicalShift).getY() / tileLength));
+
+    int px = (direction.first  == 1 ? 1 : 0);
+    int py = (direction.second == 1 ? 1 : 0);
+
+    int ox = px;
+    int oy = py;
+
+    int ix = direction.first;
+    int iy = direction.second;
+
+    Distance nx = tileLength * (sx + ox) + logicalShift.getX();
+    Distance ny = tileLength * (sy + oy) + logicalShift.getY();
+
+    Direction wx = (direction.first  == 1 ? Direction::EAST  : Direction::WEST );
+    Direction wy = (direction.second == 1 ? Direction::NORTH : Direction::SOUTH);
+
+    static std::function<bool(const Distance&, const Distance&)> east = [](const Distance& nx, const Distance& ex) {
+        return nx < ex;
+    };
+    static std::function<bool(const Distance&, const Distance&)> west = [](const Distance& nx, const Distance& ex) {
+        return ex < nx;
+    };
+    static std::function<bool(const Distance&, const Distance&)> north = [](const Distance& ny, const Distance& ey) {
+        return ny < ey;
+    };
+    static std::function<bool(const Distance&, const Distance&)> south = [](const Distance& ny, const Distance& ey) {
+        return ey < ny;
+    };
+    std::function<bool(const Distance&, const Distance&)>* bx = (direction.first  == 1 ? &east  : &west );
+    std::function<bool(const Distance&, const Distance&)>* by = (direction.second == 1 ? &north : &south);
+
+    while ((*bx)(nx, end.getX()) || (*by)(ny, end.getY())) {
+
+        bool x_first;
+        if (dx == Distance::Meters(0.0)) {
+            x_first = false;
+        }
+        else if (dy == Distance::Meters(0.0)) {
+            x_first = true;
+        }
+        else {
+            x_first = std::abs((nx - cx) / dx) < std::abs((ny - cy) / dy);
+        }
+
+        if (x_first) {
+            cy = cy + (nx - cx) * (dy / dx);
+            cx = nx;
+            int x = sx + ox - px;
+            int y = sy + oy - py;
+            if (GeometryUtilities::isOnTileEdge(cy, halfWallWidth, tileLength) ||
+                    (maze.withinMaze(x, y) && maze.isWall(x, y, wx))) {
+                return Coordinate::Cartesian(cx, cy);
+            }
+            ox += ix;
+            nx = tileLength * (sx + ox) + logicalShift.getX();
+        }
+        else {
+            cx = cx + (ny - cy) * (dx / dy);
+            cy = ny;
+            int x = sx + ox - px;
+            int y = sy + oy - py;
+            if (GeometryUtilities::isOnTileEdge(cx, halfWallWidth, tileLength) ||
+                    (maze.withinMaze(x, y) && maze.isWall(x, y, wy))) {
+                return Coordinate::Cartesian(cx, cy);
+            }
+            oy += iy;
+            ny = tileLength * (sy + oy) + logicalShift.getY();
+        }
+    }
+
+    return end;
+}
+
+// A width x height maze with its boundary walls and, inside of it, each wall
+// present with the given probability
+BasicMaze randomWalls(int width, int height, double probability, std::mt19937* rng) {
+    std::bernoulli_distribution isWall(probability);
+    BasicMaze walls(width, height);
+    for (int x = 0; x < width; x += 1) {
+        for (int y = 0; y < height; y += 1) {
+            walls.setWall(x, y, Direction::EAST,
+                x == width - 1 || isWall(*rng));
+            walls.setWall(x, y, Direction::NORTH,
+                y == height - 1 || isWall(*rng));
+            if (x == 0) {
+                walls.setWall(x, y, Direction::WEST, true);
+            }
+            if (y == 0) {
+                walls.setWall(x, y, Direction::SOUTH, true);
+            }
+        }
+    }
+    return walls;
+}
+
+// Times one of the algorithms over all of the rays, storing the hit points
+template<typename CastRay>
+qint64 timeRays(
+    CastRay castRay,
+    const QVector<QPair<Coordinate, Coordinate>>& rays,
+    QVector<Coordinate>* hits
+) {
+    hits->resize(rays.size());
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < rays.size(); i += 1) {
+        (*hits)[i] = castRay(rays.at(i).first, rays.at(i).second);
+    }
+    return timer.nsecsElapsed();
+}
+
+int main(int argc, char* argv[]) {
+
+    // Maze construction reads the simulator's parameters
+    QCoreApplication app(argc, argv);
+
+    int numberOfRays = 2000000;
+    if (1 < argc) {
+        numberOfRays = QString(argv[1]).toInt();
+    }
+
+    // The same dimensions and range as the sensors use
+    Distance halfWallWidth = Distance::Meters(P()->wallWidth() / 2.0);
+    Distance tileLength = Distance::Meters(P()->wallLength() + P()->wallWidth());
+    Distance maxLength = Distance::Meters(0.3);
+
+    std::mt19937 rng(20261018);
+    BasicMaze walls = randomWalls(16, 16, 0.4, &rng);
+
+    // The untransformed maze reads the wall bits directly, while the rotated
+    // one goes through BasicMaze::isWall(), so we exercise both paths
+    QVector<QPair<QString, std::shared_ptr<Maze>>> mazes = {
+        {"identity", std::shared_ptr<Maze>(Maze::fromWalls(walls))},
+        {"rotated", std::shared_ptr<Maze>(Maze::fromWalls(walls, MazeSymmetry(1, false)))},
+    };
+
+    // Rays start anywhere in (or just outside of) the maze, and every eighth
+    // one is axis-aligned, which has its own branch in the loop
+    double extent = tileLength.getMeters() * 16;
+    std::uniform_real_distribution<double> position(-0.05, extent + 0.05);
+    std::uniform_real_distribution<double> angle(0.0, 360.0);
+    std::uniform_real_distribution<double> length(0.0, maxLength.getMeters());
+    std::uniform_int_distribution<int> quadrant(0, 3);
+    QVector<QPair<Coordinate, Coordinate>> rays;
+    rays.reserve(numberOfRays);
+    for (int i = 0; i < numberOfRays; i += 1) {
+        Coordinate start = Coordinate::Cartesian(
+            Distance::Meters(position(rng)),
+            Distance::Meters(position(rng)));
+        Distance rho = Distance::Meters(length(rng));
+        Coordinate offset;
+        if (i % 8 == 0) {
+            // Built directly, since cos() and sin() of multiples of 90
+            // degrees aren't exactly zero
+            int q = quadrant(rng);
+            offset = Coordinate::Cartesian(
+                q == 0 ? rho : (q == 2 ? rho * -1 : Distance()),
+                q == 1 ? rho : (q == 3 ? rho * -1 : Distance()));
+        }
+        else {
+            offset = Coordinate::Polar(rho, Angle::Degrees(angle(rng)));
+        }
+        rays.push_back({start, start + offset});
+    }
+
+    bool allEqual = true;
+    for (const auto& pair : mazes) {
+        const Maze& maze = *pair.second;
+
+        QVector<Coordinate> referenceHits;
+        qint64 referenceNanos = timeRays(
+            [&](const Coordinate& start, const Coordinate& end) {
+                return referenceCastRay(start, end, maze, halfWallWidth, tileLength);
+            },
+            rays,
+            &referenceHits);
+
+        QVector<Coordinate> hits;
+        qint64 nanos = timeRays(
+            [&](const Coordinate& start, const Coordinate& end) {
+                return GeometryUtilities::castRay(start, end, maze, halfWallWidth, tileLength);
+            },
+            rays,
+            &hits);
+
+        // The hit points should be identical, up to rounding in the tile
+        // edge test, which now subtracts the tile's start instead of fmod()
+        int mismatches = 0;
+        double maxError = 0.0;
+        for (int i = 0; i < rays.size(); i += 1) {
+            double error = std::hypot(
+                (hits.at(i).getX() - referenceHits.at(i).getX()).getMeters(),
+                (hits.at(i).getY() - referenceHits.at(i).getY()).getMeters());
+            if (1e-9 < error) {
+                mismatches += 1;
+            }
+            maxError = std::max(maxError, error);
+        }
+        allEqual = allEqual && mismatches == 0;
+
+        qInfo().noquote().nospace()
+            << pair.first << ": " << rays.size() << " rays, reference "
+            << referenceNanos / 1e9 << " s, castRay " << nanos / 1e9
+            << " s (" << static_cast<double>(referenceNanos) / nanos
+            << "x), " << mismatches << " mismatches, max error "
+            << maxError << " m";
+    }
+
+    return allEqual ? 0 : 1;
+}